@@ -0,0 +1,318 @@
+package ast
+
+/*
+ * Allocates AST nodes out of slabs of each node type instead of one heap object per node
+ * A parse makes a handful of big allocations rather than one for every node, which is a lot less for the GC to track
+ * Nodes are never freed one by one, Reset drops every slab at once
+ *
+ * A nil *Arena is valid and allocates every node on its own, like new() would
+ */
+type Arena struct {
+	PackageClauses     []PackageClause
+	IdentifierExprs    []IdentifierExpr
+	NumberLitExprs     []NumberLitExpr
+	StringLitExprs     []StringLitExpr
+	BinaryExprs        []BinaryExpr
+	UnaryExprs         []UnaryExpr
+	CallExprs          []CallExpr
+	NullExprs          []NullExpr
+	VoidExprs          []VoidExpr
+	VarRefExprs        []VarRefExpr
+	PrimitiveTypeExprs []PrimitiveTypeExpr
+	PointerTypeExprs   []PointerTypeExpr
+	InterfaceTypeExprs []InterfaceTypeExpr
+	StructTypeExprs    []StructTypeExpr
+	ExprStmts          []ExprStmt
+	ReturnStmts        []ReturnStmt
+	FuncDecls          []FuncDecl
+	VarDecls           []VarDecl
+	TypeDecls          []TypeDecl
+
+	Forks []*Arena
+}
+
+const (
+	minArenaSlab = 16
+	maxArenaSlab = 4096
+)
+
+// Drop every node allocated so far, nothing allocated from the arena may be used after this
+func (a *Arena) Reset() {
+	*a = Arena{}
+}
+
+/*
+ * Get a new arena for another goroutine to allocate from, it's Reset along with this one
+ * Arenas aren't safe to share between goroutines but forking is, as long as it's only done from the goroutine that owns a
+ */
+func (a *Arena) Fork() *Arena {
+	if a == nil {
+		return nil
+	}
+	fork := &Arena{}
+	a.Forks = append(a.Forks, fork)
+	return fork
+}
+
+/*
+ * Capacity of the slab that replaces a full one of capacity n
+ * Slabs double in size so small inputs don't pay for big slabs
+ */
+func nextSlab(n int) int {
+	if n < minArenaSlab {
+		return minArenaSlab
+	}
+	if n >= maxArenaSlab {
+		return maxArenaSlab
+	}
+	return n * 2
+}
+
+// A full slab is left to the nodes already pointing into it and a new one takes its place
+
+func (a *Arena) NewPackageClause(node PackageClause) *PackageClause {
+	if a == nil {
+		n := new(PackageClause)
+		*n = node
+		return n
+	}
+	if len(a.PackageClauses) == cap(a.PackageClauses) {
+		a.PackageClauses = make([]PackageClause, 0, nextSlab(cap(a.PackageClauses)))
+	}
+	a.PackageClauses = append(a.PackageClauses, node)
+	return &a.PackageClauses[len(a.PackageClauses)-1]
+}
+
+func (a *Arena) NewIdentifierExpr(node IdentifierExpr) *IdentifierExpr {
+	if a == nil {
+		n := new(IdentifierExpr)
+		*n = node
+		return n
+	}
+	if len(a.IdentifierExprs) == cap(a.IdentifierExprs) {
+		a.IdentifierExprs = make([]IdentifierExpr, 0, nextSlab(cap(a.IdentifierExprs)))
+	}
+	a.IdentifierExprs = append(a.IdentifierExprs, node)
+	return &a.IdentifierExprs[len(a.IdentifierExprs)-1]
+}
+
+func (a *Arena) NewNumberLitExpr(node NumberLitExpr) *NumberLitExpr {
+	if a == nil {
+		n := new(NumberLitExpr)
+		*n = node
+		return n
+	}
+	if len(a.NumberLitExprs) == cap(a.NumberLitExprs) {
+		a.NumberLitExprs = make([]NumberLitExpr, 0, nextSlab(cap(a.NumberLitExprs)))
+	}
+	a.NumberLitExprs = append(a.NumberLitExprs, node)
+	return &a.NumberLitExprs[len(a.NumberLitExprs)-1]
+}
+
+func (a *Arena) NewStringLitExpr(node StringLitExpr) *StringLitExpr {
+	if a == nil {
+		n := new(StringLitExpr)
+		*n = node
+		return n
+	}
+	if len(a.StringLitExprs) == cap(a.StringLitExprs) {
+		a.StringLitExprs = make([]StringLitExpr, 0, nextSlab(cap(a.StringLitExprs)))
+	}
+	a.StringLitExprs = append(a.StringLitExprs, node)
+	return &a.StringLitExprs[len(a.StringLitExprs)-1]
+}
+
+func (a *Arena) NewBinaryExpr(node BinaryExpr) *BinaryExpr {
+	if a == nil {
+		n := new(BinaryExpr)
+		*n = node
+		return n
+	}
+	if len(a.BinaryExprs) == cap(a.BinaryExprs) {
+		a.BinaryExprs = make([]BinaryExpr, 0, nextSlab(cap(a.BinaryExprs)))
+	}
+	a.BinaryExprs = append(a.BinaryExprs, node)
+	return &a.BinaryExprs[len(a.BinaryExprs)-1]
+}
+
+func (a *Arena) NewUnaryExpr(node UnaryExpr) *UnaryExpr {
+	if a == nil {
+		n := new(UnaryExpr)
+		*n = node
+		return n
+	}
+	if len(a.UnaryExprs) == cap(a.UnaryExprs) {
+		a.UnaryExprs = make([]UnaryExpr, 0, nextSlab(cap(a.UnaryExprs)))
+	}
+	a.UnaryExprs = append(a.UnaryExprs, node)
+	return &a.UnaryExprs[len(a.UnaryExprs)-1]
+}
+
+func (a *Arena) NewCallExpr(node CallExpr) *CallExpr {
+	if a == nil {
+		n := new(CallExpr)
+		*n = node
+		return n
+	}
+	if len(a.CallExprs) == cap(a.CallExprs) {
+		a.CallExprs = make([]CallExpr, 0, nextSlab(cap(a.CallExprs)))
+	}
+	a.CallExprs = append(a.CallExprs, node)
+	return &a.CallExprs[len(a.CallExprs)-1]
+}
+
+func (a *Arena) NewNullExpr(node NullExpr) *NullExpr {
+	if a == nil {
+		n := new(NullExpr)
+		*n = node
+		return n
+	}
+	if len(a.NullExprs) == cap(a.NullExprs) {
+		a.NullExprs = make([]NullExpr, 0, nextSlab(cap(a.NullExprs)))
+	}
+	a.NullExprs = append(a.NullExprs, node)
+	return &a.NullExprs[len(a.NullExprs)-1]
+}
+
+func (a *Arena) NewVoidExpr(node VoidExpr) *VoidExpr {
+	if a == nil {
+		n := new(VoidExpr)
+		*n = node
+		return n
+	}
+	if len(a.VoidExprs) == cap(a.VoidExprs) {
+		a.VoidExprs = make([]VoidExpr, 0, nextSlab(cap(a.VoidExprs)))
+	}
+	a.VoidExprs = append(a.VoidExprs, node)
+	return &a.VoidExprs[len(a.VoidExprs)-1]
+}
+
+func (a *Arena) NewVarRefExpr(node VarRefExpr) *VarRefExpr {
+	if a == nil {
+		n := new(VarRefExpr)
+		*n = node
+		return n
+	}
+	if len(a.VarRefExprs) == cap(a.VarRefExprs) {
+		a.VarRefExprs = make([]VarRefExpr, 0, nextSlab(cap(a.VarRefExprs)))
+	}
+	a.VarRefExprs = append(a.VarRefExprs, node)
+	return &a.VarRefExprs[len(a.VarRefExprs)-1]
+}
+
+func (a *Arena) NewPrimitiveTypeExpr(node PrimitiveTypeExpr) *PrimitiveTypeExpr {
+	if a == nil {
+		n := new(PrimitiveTypeExpr)
+		*n = node
+		return n
+	}
+	if len(a.PrimitiveTypeExprs) == cap(a.PrimitiveTypeExprs) {
+		a.PrimitiveTypeExprs = make([]PrimitiveTypeExpr, 0, nextSlab(cap(a.PrimitiveTypeExprs)))
+	}
+	a.PrimitiveTypeExprs = append(a.PrimitiveTypeExprs, node)
+	return &a.PrimitiveTypeExprs[len(a.PrimitiveTypeExprs)-1]
+}
+
+func (a *Arena) NewPointerTypeExpr(node PointerTypeExpr) *PointerTypeExpr {
+	if a == nil {
+		n := new(PointerTypeExpr)
+		*n = node
+		return n
+	}
+	if len(a.PointerTypeExprs) == cap(a.PointerTypeExprs) {
+		a.PointerTypeExprs = make([]PointerTypeExpr, 0, nextSlab(cap(a.PointerTypeExprs)))
+	}
+	a.PointerTypeExprs = append(a.PointerTypeExprs, node)
+	return &a.PointerTypeExprs[len(a.PointerTypeExprs)-1]
+}
+
+func (a *Arena) NewInterfaceTypeExpr(node InterfaceTypeExpr) *InterfaceTypeExpr {
+	if a == nil {
+		n := new(InterfaceTypeExpr)
+		*n = node
+		return n
+	}
+	if len(a.InterfaceTypeExprs) == cap(a.InterfaceTypeExprs) {
+		a.InterfaceTypeExprs = make([]InterfaceTypeExpr, 0, nextSlab(cap(a.InterfaceTypeExprs)))
+	}
+	a.InterfaceTypeExprs = append(a.InterfaceTypeExprs, node)
+	return &a.InterfaceTypeExprs[len(a.InterfaceTypeExprs)-1]
+}
+
+func (a *Arena) NewStructTypeExpr(node StructTypeExpr) *StructTypeExpr {
+	if a == nil {
+		n := new(StructTypeExpr)
+		*n = node
+		return n
+	}
+	if len(a.StructTypeExprs) == cap(a.StructTypeExprs) {
+		a.StructTypeExprs = make([]StructTypeExpr, 0, nextSlab(cap(a.StructTypeExprs)))
+	}
+	a.StructTypeExprs = append(a.StructTypeExprs, node)
+	return &a.StructTypeExprs[len(a.StructTypeExprs)-1]
+}
+
+func (a *Arena) NewExprStmt(node ExprStmt) *ExprStmt {
+	if a == nil {
+		n := new(ExprStmt)
+		*n = node
+		return n
+	}
+	if len(a.ExprStmts) == cap(a.ExprStmts) {
+		a.ExprStmts = make([]ExprStmt, 0, nextSlab(cap(a.ExprStmts)))
+	}
+	a.ExprStmts = append(a.ExprStmts, node)
+	return &a.ExprStmts[len(a.ExprStmts)-1]
+}
+
+func (a *Arena) NewReturnStmt(node ReturnStmt) *ReturnStmt {
+	if a == nil {
+		n := new(ReturnStmt)
+		*n = node
+		return n
+	}
+	if len(a.ReturnStmts) == cap(a.ReturnStmts) {
+		a.ReturnStmts = make([]ReturnStmt, 0, nextSlab(cap(a.ReturnStmts)))
+	}
+	a.ReturnStmts = append(a.ReturnStmts, node)
+	return &a.ReturnStmts[len(a.ReturnStmts)-1]
+}
+
+func (a *Arena) NewFuncDecl(node FuncDecl) *FuncDecl {
+	if a == nil {
+		n := new(FuncDecl)
+		*n = node
+		return n
+	}
+	if len(a.FuncDecls) == cap(a.FuncDecls) {
+		a.FuncDecls = make([]FuncDecl, 0, nextSlab(cap(a.FuncDecls)))
+	}
+	a.FuncDecls = append(a.FuncDecls, node)
+	return &a.FuncDecls[len(a.FuncDecls)-1]
+}
+
+func (a *Arena) NewVarDecl(node VarDecl) *VarDecl {
+	if a == nil {
+		n := new(VarDecl)
+		*n = node
+		return n
+	}
+	if len(a.VarDecls) == cap(a.VarDecls) {
+		a.VarDecls = make([]VarDecl, 0, nextSlab(cap(a.VarDecls)))
+	}
+	a.VarDecls = append(a.VarDecls, node)
+	return &a.VarDecls[len(a.VarDecls)-1]
+}
+
+func (a *Arena) NewTypeDecl(node TypeDecl) *TypeDecl {
+	if a == nil {
+		n := new(TypeDecl)
+		*n = node
+		return n
+	}
+	if len(a.TypeDecls) == cap(a.TypeDecls) {
+		a.TypeDecls = make([]TypeDecl, 0, nextSlab(cap(a.TypeDecls)))
+	}
+	a.TypeDecls = append(a.TypeDecls, node)
+	return &a.TypeDecls[len(a.TypeDecls)-1]
+}
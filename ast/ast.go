@@ -55,6 +55,7 @@ type (
 
 	Method struct {
 		Name   string
+		Sym    Symbol
 		Params ParamList
 		Return Expr
 	}
@@ -86,6 +87,7 @@ type (
 	IdentifierExpr struct {
 		NamePos TokenPos
 		Name    string
+		Sym     Symbol
 	}
 
 	NumberLitExpr struct {
@@ -131,6 +133,7 @@ type (
 	VarRefExpr struct {
 		Pos  TokenPos
 		Name string
+		Sym  Symbol
 	}
 
 	PrimitiveTypeExpr struct {
@@ -173,8 +176,8 @@ type (
 		Name      string
 		List      []Stmt
 		End       TokenPos
-		Constants map[string]value.Value
-		Mutables  map[string]value.Value
+		Constants map[Symbol]value.Value
+		Mutables  map[Symbol]value.Value
 	}
 
 	ReturnStmt struct {
@@ -200,8 +203,10 @@ type (
 	FuncDecl struct {
 		Receiver FuncReceiver
 		Name     string
+		Sym      Symbol
 		FuncType FuncType
-		Body     BlockStmt
+		Body     BlockStmt // Empty until ExpandBody if the body was skipped, see LazyBody
+		Lazy     *LazyBody `json:"-"`
 	}
 )
 
@@ -210,11 +215,13 @@ type (
 		Mut    bool
 		Type   Expr
 		Names  []string
+		Syms   []Symbol
 		Values []Expr
 	}
 
 	TypeDecl struct {
 		Name string
+		Sym  Symbol
 		Type Expr
 	}
 )
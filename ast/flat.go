@@ -0,0 +1,651 @@
+package ast
+
+import (
+	"fmt"
+
+	"github.com/llir/llvm/ir/value"
+)
+
+type NodeKind uint8
+
+const (
+	KindEmpty NodeKind = iota
+	KindPackageClause
+	KindIdentifier
+	KindNumberLit
+	KindStringLit
+	KindBinary
+	KindUnary
+	KindCall
+	KindNull
+	KindVoid
+	KindVarRef
+	KindPrimitiveType
+	KindPointerType
+	KindInterfaceType
+	KindMethodList
+	KindMethod
+	KindStructType
+	KindPropertyList
+	KindProperty
+	KindParamList
+	KindParam
+	KindExprStmt
+	KindBlockStmt
+	KindReturnStmt
+	KindFuncReceiver
+	KindFuncType
+	KindFuncDecl
+	KindVarDecl
+	KindTypeDecl
+)
+
+// Flag bits in FlatAST.Tags
+const (
+	FlagMut = 1 << iota
+	FlagPub
+	FlagMaps // A BlockStmt whose Constants and Mutables have been made
+)
+
+// A missing child, like a nil Expr
+const NoNode = ^uint32(0)
+
+type FlatPos struct {
+	Row, Col int32
+}
+
+/*
+ * An AST stored as parallel arrays indexed by node instead of as nodes pointing at each other
+ * Children always come before their parents, so walking the tree bottom up is a loop over the arrays
+ * Every field is a slice of plain numbers or bytes, so the whole thing can be copied in and out in a few big blocks
+ *
+ * What Lhs, Rhs and Extra hold depends on the Kind (N is a node index, S an index in Strings, E an offset in Extra):
+ *
+ *	PackageClause  Lhs S Name
+ *	Identifier     Lhs S Name, Rhs Sym
+ *	NumberLit      Lhs S Value, Rhs N Type
+ *	StringLit      Lhs S Value
+ *	Binary         Lhs N X, Rhs N Y, Tag Op
+ *	Unary          Lhs N X, Tag Op
+ *	Call           Lhs N Fn, Rhs E [close paren Row, Col, len(Args), Args...]
+ *	Null           Lhs N Type
+ *	VarRef         Lhs S Name, Rhs Sym
+ *	PrimitiveType  Tag PrimitiveType
+ *	PointerType    Lhs N PointerToType
+ *	InterfaceType  Lhs N MethodList
+ *	MethodList     Rhs E [End Row, Col, len(Methods), Methods...]
+ *	Method         Lhs S Name, Rhs E [Sym, N ParamList, N Return]
+ *	StructType     Lhs N PropertyList, Rhs S Name
+ *	PropertyList   Rhs E [End Row, Col, len(Properties), Properties...]
+ *	Property       Lhs N Type, Rhs E [len(Names), S Names...], Tag FlagPub|FlagMut
+ *	ParamList      Rhs E [End Row, Col, len(Params), Params...]
+ *	Param          Lhs N Type, Rhs S Name, Tag FlagMut
+ *	ExprStmt       Lhs N X
+ *	BlockStmt      Lhs S Name, Rhs E [End Row, Col, len(List), List...], Tag FlagMaps
+ *	ReturnStmt     Lhs N Type, Rhs N Value
+ *	FuncReceiver   Lhs S Name, Rhs N Type
+ *	FuncType       Lhs N ParamList, Rhs N Return
+ *	FuncDecl       Lhs S Name, Rhs E [Sym, N Receiver, N FuncType, N Body]
+ *	VarDecl        Lhs N Type, Rhs E [len(Names), (S Name, Sym)..., len(Values), Values...], Tag FlagMut
+ *	TypeDecl       Lhs S Name, Rhs E [Sym, N Type]
+ *
+ * Pos is the node's first position field, if it has one
+ * Nodes that more than one node points at (like the Type of number literals) are only stored once
+ */
+type FlatAST struct {
+	Kinds   []NodeKind
+	Tags    []uint8
+	Pos     []FlatPos
+	Lhs     []uint32
+	Rhs     []uint32
+	Extra   []uint32
+	Text    []byte
+	Strings []uint32 // String i is Text[Strings[i]:Strings[i+1]]
+	Roots   []uint32 // Top level nodes
+	Idents  []uint32 // Strings of the identifiers in the source in the order they first appear, see Reintern
+
+	stringIDs map[string]uint32
+	seen      map[Node]uint32
+	frames    []flatFrame // Add's stack
+	pending   []Node
+	done      []uint32
+}
+
+func flatPos(pos TokenPos) FlatPos {
+	return FlatPos{Row: int32(pos.Row), Col: int32(pos.Col)}
+}
+
+func (pos FlatPos) TokenPos() TokenPos {
+	return TokenPos{Row: int(pos.Row), Col: int(pos.Col)}
+}
+
+// Flatten nodes into flat, replacing what was in it
+func (flat *FlatAST) Flatten(nodes []Node) error {
+	*flat = FlatAST{Strings: []uint32{0}, stringIDs: map[string]uint32{}, seen: map[Node]uint32{}}
+	for _, node := range nodes {
+		root, err := flat.Add(node)
+		if err != nil {
+			return err
+		}
+		flat.Roots = append(flat.Roots, root)
+	}
+	flat.stringIDs = nil
+	flat.seen = nil
+	flat.frames, flat.pending, flat.done = nil, nil, nil
+	return nil
+}
+
+// Record the identifiers of the source the nodes came from, in the order they first appear in it
+func (flat *FlatAST) SetIdents(names []string) {
+	if flat.stringIDs == nil {
+		flat.stringIDs = make(map[string]uint32, len(flat.Strings))
+		for i := 0; i+1 < len(flat.Strings); i++ {
+			flat.stringIDs[flat.String(uint32(i))] = uint32(i)
+		}
+	}
+	flat.Idents = flat.Idents[:0]
+	for _, name := range names {
+		flat.Idents = append(flat.Idents, flat.addString(name))
+	}
+	flat.stringIDs = nil
+}
+
+func (flat *FlatAST) NumNodes() int {
+	return len(flat.Kinds)
+}
+
+func (flat *FlatAST) String(s uint32) string {
+	return string(flat.Text[flat.Strings[s]:flat.Strings[s+1]])
+}
+
+func (flat *FlatAST) push(kind NodeKind, tag uint8, pos TokenPos, lhs, rhs uint32) uint32 {
+	flat.Kinds = append(flat.Kinds, kind)
+	flat.Tags = append(flat.Tags, tag)
+	flat.Pos = append(flat.Pos, flatPos(pos))
+	flat.Lhs = append(flat.Lhs, lhs)
+	flat.Rhs = append(flat.Rhs, rhs)
+	return uint32(len(flat.Kinds) - 1)
+}
+
+func (flat *FlatAST) addString(s string) uint32 {
+	if id, ok := flat.stringIDs[s]; ok {
+		return id
+	}
+	id := uint32(len(flat.Strings) - 1)
+	flat.Text = append(flat.Text, s...)
+	flat.Strings = append(flat.Strings, uint32(len(flat.Text)))
+	flat.stringIDs[s] = id
+	return id
+}
+
+// Append words to Extra, returning where they start
+func (flat *FlatAST) addExtra(words ...uint32) uint32 {
+	offset := uint32(len(flat.Extra))
+	flat.Extra = append(flat.Extra, words...)
+	return offset
+}
+
+// The ids of a node's children, in the order enter listed them
+type childIDs []uint32
+
+func (ids *childIDs) next() uint32 {
+	id := (*ids)[0]
+	*ids = (*ids)[1:]
+	return id
+}
+
+// Lists are stored after their children, so their words are built up here first
+func addList(words []uint32, end TokenPos, n int, add func(i int) uint32) []uint32 {
+	words = append(words, uint32(int32(end.Row)), uint32(int32(end.Col)), uint32(n))
+	for i := 0; i < n; i++ {
+		words = append(words, add(i))
+	}
+	return words
+}
+
+// A node Add is part way through, its children are pending[children:end] and the ids of the ones added so far are done[ids:]
+type flatFrame struct {
+	node          Node
+	children, end int
+	next          int
+	ids           int
+}
+
+/*
+ * Add a node and everything under it, returning its index
+ * The tree is walked with an explicit stack, a million term expression is a million frames on it rather than on the goroutine's stack
+ */
+func (flat *FlatAST) Add(node Node) (uint32, error) {
+	if node == nil {
+		return NoNode, nil
+	}
+	if id, ok := flat.seen[node]; ok {
+		return id, nil
+	}
+
+	flat.frames, flat.pending, flat.done = flat.frames[:0], flat.pending[:0], flat.done[:0]
+	if err := flat.enter(node); err != nil {
+		return NoNode, err
+	}
+	for len(flat.frames) > 0 {
+		frame := &flat.frames[len(flat.frames)-1]
+		if frame.next < frame.end {
+			child := flat.pending[frame.next]
+			frame.next++
+			if child == nil {
+				flat.done = append(flat.done, NoNode)
+			} else if id, ok := flat.seen[child]; ok {
+				flat.done = append(flat.done, id)
+			} else if err := flat.enter(child); err != nil {
+				return NoNode, err
+			}
+			continue
+		}
+
+		id := flat.build(frame.node, flat.done[frame.ids:])
+		flat.seen[frame.node] = id
+		flat.pending = flat.pending[:frame.children]
+		flat.done = append(flat.done[:frame.ids], id)
+		flat.frames = flat.frames[:len(flat.frames)-1]
+	}
+	return flat.done[0], nil
+}
+
+// Push a frame for node, with the nodes under it that have to be added first
+func (flat *FlatAST) enter(node Node) error {
+	start := len(flat.pending)
+	switch n := node.(type) {
+	default:
+		return fmt.Errorf("can't flatten node of type %T", node)
+	case *EmptyExpr, *PackageClause, *IdentifierExpr, *StringLitExpr, *VoidExpr, *VarRefExpr, *PrimitiveTypeExpr:
+	case *NumberLitExpr:
+		flat.pending = append(flat.pending, n.Type)
+	case *BinaryExpr:
+		flat.pending = append(flat.pending, n.X, n.Y)
+	case *UnaryExpr:
+		flat.pending = append(flat.pending, n.X)
+	case *CallExpr:
+		flat.pending = append(flat.pending, n.Fn)
+		for _, arg := range n.Args {
+			flat.pending = append(flat.pending, arg)
+		}
+	case *NullExpr:
+		flat.pending = append(flat.pending, n.Type)
+	case *PointerTypeExpr:
+		flat.pending = append(flat.pending, n.PointerToType)
+	case *InterfaceTypeExpr:
+		for i := range n.Methods.Methods {
+			method := &n.Methods.Methods[i]
+			flat.pendParams(&method.Params)
+			flat.pending = append(flat.pending, method.Return)
+		}
+	case *StructTypeExpr:
+		for i := range n.Properties.Properties {
+			flat.pending = append(flat.pending, n.Properties.Properties[i].Type)
+		}
+	case *ExprStmt:
+		flat.pending = append(flat.pending, n.X)
+	case *ReturnStmt:
+		flat.pending = append(flat.pending, n.Type, n.Value)
+	case *FuncDecl:
+		// A skipped body has to be parsed to be stored
+		if err := n.ExpandBody(); err != nil {
+			return err
+		}
+		if n.Receiver != (FuncReceiver{}) {
+			flat.pending = append(flat.pending, n.Receiver.Type)
+		}
+		flat.pendParams(&n.FuncType.Params)
+		flat.pending = append(flat.pending, n.FuncType.Return)
+		for _, stmt := range n.Body.List {
+			flat.pending = append(flat.pending, stmt)
+		}
+	case *VarDecl:
+		flat.pending = append(flat.pending, n.Type)
+		for _, val := range n.Values {
+			flat.pending = append(flat.pending, val)
+		}
+	case *TypeDecl:
+		flat.pending = append(flat.pending, n.Type)
+	}
+	flat.frames = append(flat.frames, flatFrame{node: node, children: start, end: len(flat.pending), next: start, ids: len(flat.done)})
+	return nil
+}
+
+func (flat *FlatAST) pendParams(list *ParamList) {
+	for i := range list.Params {
+		flat.pending = append(flat.pending, list.Params[i].Type)
+	}
+}
+
+// Push node once everything enter listed for it has been added
+func (flat *FlatAST) build(node Node, ids childIDs) uint32 {
+	switch n := node.(type) {
+	case *EmptyExpr:
+		return flat.push(KindEmpty, 0, TokenPos{}, 0, 0)
+	case *PackageClause:
+		return flat.push(KindPackageClause, 0, TokenPos{}, flat.addString(n.Name), 0)
+	case *IdentifierExpr:
+		return flat.push(KindIdentifier, 0, n.NamePos, flat.addString(n.Name), uint32(n.Sym))
+	case *NumberLitExpr:
+		return flat.push(KindNumberLit, 0, n.ValuePos, flat.addString(n.Value), ids.next())
+	case *StringLitExpr:
+		return flat.push(KindStringLit, 0, n.ValuePos, flat.addString(n.Value), 0)
+	case *BinaryExpr:
+		return flat.push(KindBinary, uint8(n.Op), n.OpPos, ids[0], ids[1])
+	case *UnaryExpr:
+		return flat.push(KindUnary, uint8(n.Op), n.OpPos, ids.next(), 0)
+	case *CallExpr:
+		fn := ids.next()
+		words := addList(nil, n.CloseParenPos, len(n.Args), func(int) uint32 { return ids.next() })
+		return flat.push(KindCall, 0, n.OpenParenPos, fn, flat.addExtra(words...))
+	case *NullExpr:
+		return flat.push(KindNull, 0, n.Pos, ids.next(), 0)
+	case *VoidExpr:
+		return flat.push(KindVoid, 0, n.Pos, 0, 0)
+	case *VarRefExpr:
+		return flat.push(KindVarRef, 0, n.Pos, flat.addString(n.Name), uint32(n.Sym))
+	case *PrimitiveTypeExpr:
+		return flat.push(KindPrimitiveType, uint8(n.PrimitiveType), n.Pos, 0, 0)
+	case *PointerTypeExpr:
+		return flat.push(KindPointerType, 0, n.Pos, ids.next(), 0)
+	case *InterfaceTypeExpr:
+		return flat.push(KindInterfaceType, 0, n.InterfacePos, flat.addMethodList(&n.Methods, &ids), 0)
+	case *StructTypeExpr:
+		return flat.push(KindStructType, 0, n.StructPos, flat.addPropertyList(&n.Properties, &ids), flat.addString(n.Name))
+	case *ExprStmt:
+		return flat.push(KindExprStmt, 0, TokenPos{}, ids.next(), 0)
+	case *ReturnStmt:
+		return flat.push(KindReturnStmt, 0, n.ReturnPos, ids[0], ids[1])
+	case *FuncDecl:
+		return flat.addFuncDecl(n, &ids)
+	case *VarDecl:
+		return flat.addVarDecl(n, &ids)
+	case *TypeDecl:
+		return flat.push(KindTypeDecl, 0, TokenPos{}, flat.addString(n.Name), flat.addExtra(uint32(n.Sym), ids.next()))
+	}
+	panic(fmt.Sprintf("can't flatten node of type %T", node))
+}
+
+func flags(mut, pub bool) uint8 {
+	var tag uint8
+	if mut {
+		tag |= FlagMut
+	}
+	if pub {
+		tag |= FlagPub
+	}
+	return tag
+}
+
+func (flat *FlatAST) addMethodList(list *MethodList, ids *childIDs) uint32 {
+	words := addList(nil, list.End, len(list.Methods), func(i int) uint32 {
+		method := &list.Methods[i]
+		params := flat.addParamList(&method.Params, ids)
+		return flat.push(KindMethod, 0, TokenPos{}, flat.addString(method.Name), flat.addExtra(uint32(method.Sym), params, ids.next()))
+	})
+	return flat.push(KindMethodList, 0, list.Start, 0, flat.addExtra(words...))
+}
+
+func (flat *FlatAST) addPropertyList(list *PropertyList, ids *childIDs) uint32 {
+	words := addList(nil, list.End, len(list.Properties), func(i int) uint32 {
+		property := &list.Properties[i]
+		ty := ids.next()
+		names := flat.addExtra(uint32(len(property.Names)))
+		for _, name := range property.Names {
+			flat.addExtra(flat.addString(name))
+		}
+		return flat.push(KindProperty, flags(property.Mut, property.Pub), TokenPos{}, ty, names)
+	})
+	return flat.push(KindPropertyList, 0, list.Start, 0, flat.addExtra(words...))
+}
+
+func (flat *FlatAST) addParamList(list *ParamList, ids *childIDs) uint32 {
+	words := addList(nil, list.End, len(list.Params), func(i int) uint32 {
+		param := &list.Params[i]
+		return flat.push(KindParam, flags(param.Mut, false), TokenPos{}, ids.next(), flat.addString(param.Name))
+	})
+	return flat.push(KindParamList, 0, list.Start, 0, flat.addExtra(words...))
+}
+
+func (flat *FlatAST) addBlockStmt(block *BlockStmt, ids *childIDs) uint32 {
+	words := addList(nil, block.End, len(block.List), func(int) uint32 { return ids.next() })
+	var tag uint8
+	if block.Constants != nil {
+		tag = FlagMaps
+	}
+	return flat.push(KindBlockStmt, tag, block.Start, flat.addString(block.Name), flat.addExtra(words...))
+}
+
+func (flat *FlatAST) addFuncDecl(fn *FuncDecl, ids *childIDs) uint32 {
+	recv := NoNode
+	if fn.Receiver != (FuncReceiver{}) {
+		recv = flat.push(KindFuncReceiver, 0, fn.Receiver.Pos, flat.addString(fn.Receiver.Name), ids.next())
+	}
+	params := flat.addParamList(&fn.FuncType.Params, ids)
+	fnType := flat.push(KindFuncType, 0, fn.FuncType.FuncPos, params, ids.next())
+	body := flat.addBlockStmt(&fn.Body, ids)
+	return flat.push(KindFuncDecl, 0, TokenPos{}, flat.addString(fn.Name), flat.addExtra(uint32(fn.Sym), recv, fnType, body))
+}
+
+func (flat *FlatAST) addVarDecl(varDecl *VarDecl, ids *childIDs) uint32 {
+	ty := ids.next()
+	words := []uint32{uint32(len(varDecl.Names))}
+	for i, name := range varDecl.Names {
+		words = append(words, flat.addString(name), uint32(varDecl.Syms[i]))
+	}
+	words = append(words, uint32(len(varDecl.Values)))
+	for range varDecl.Values {
+		words = append(words, ids.next())
+	}
+	return flat.push(KindVarDecl, flags(varDecl.Mut, false), TokenPos{}, ty, flat.addExtra(words...))
+}
+
+/*
+ * Build the tree back up out of flat, allocating nodes in arena
+ * Nodes are built in index order, so every child already exists by the time its parent is built
+ * A FlatAST that doesn't hold together (a child after its parent, a list running off the end of Extra) is an error
+ */
+func (flat *FlatAST) Inflate(arena *Arena) (nodes []Node, err error) {
+	defer func() {
+		if r := recover(); r != nil {
+			nodes, err = nil, fmt.Errorf("corrupt flat AST: %v", r)
+		}
+	}()
+
+	// Every string shares one copy of Text
+	text := string(flat.Text)
+	str := func(s uint32) string {
+		return text[flat.Strings[s]:flat.Strings[s+1]]
+	}
+
+	// Lists and such are stored by value in their parents, they're kept here until then and slot says where
+	var counts [KindTypeDecl + 1]int
+	for _, kind := range flat.Kinds {
+		if kind <= KindTypeDecl {
+			counts[kind]++
+		}
+	}
+	var (
+		methodLists   = make([]MethodList, 0, counts[KindMethodList])
+		methods       = make([]Method, 0, counts[KindMethod])
+		propertyLists = make([]PropertyList, 0, counts[KindPropertyList])
+		properties    = make([]Property, 0, counts[KindProperty])
+		paramLists    = make([]ParamList, 0, counts[KindParamList])
+		params        = make([]Param, 0, counts[KindParam])
+		blocks        = make([]BlockStmt, 0, counts[KindBlockStmt])
+		receivers     = make([]FuncReceiver, 0, counts[KindFuncReceiver])
+		funcTypes     = make([]FuncType, 0, counts[KindFuncType])
+	)
+	built := make([]Node, len(flat.Kinds))
+	slot := make([]uint32, len(flat.Kinds))
+
+	var i int
+	node := func(id uint32) Node {
+		if id == NoNode {
+			return nil
+		}
+		if int(id) >= i || built[id] == nil {
+			panic(fmt.Sprintf("node %d isn't a node built before node %d", id, i))
+		}
+		return built[id]
+	}
+	stored := func(id uint32, kind NodeKind) uint32 {
+		if int(id) >= i || flat.Kinds[id] != kind {
+			panic(fmt.Sprintf("node %d isn't a %d built before node %d", id, kind, i))
+		}
+		return slot[id]
+	}
+	extraPos := func(e uint32) TokenPos {
+		return TokenPos{Row: int(int32(flat.Extra[e])), Col: int(int32(flat.Extra[e+1]))}
+	}
+	children := func(e uint32) []uint32 {
+		n := flat.Extra[e+2]
+		return flat.Extra[e+3 : e+3+n]
+	}
+	exprs := func(ids []uint32) []Expr {
+		if len(ids) == 0 {
+			return nil
+		}
+		list := make([]Expr, len(ids))
+		for j, id := range ids {
+			list[j] = node(id)
+		}
+		return list
+	}
+
+	for ; i < len(flat.Kinds); i++ {
+		pos, lhs, rhs, tag := flat.Pos[i].TokenPos(), flat.Lhs[i], flat.Rhs[i], flat.Tags[i]
+		switch kind := flat.Kinds[i]; kind {
+		default:
+			return nil, fmt.Errorf("can't inflate node %d of unknown kind %d", i, kind)
+		case KindEmpty:
+			built[i] = &EmptyExpr{}
+		case KindPackageClause:
+			built[i] = arena.NewPackageClause(PackageClause{Name: str(lhs)})
+		case KindIdentifier:
+			built[i] = arena.NewIdentifierExpr(IdentifierExpr{NamePos: pos, Name: str(lhs), Sym: Symbol(rhs)})
+		case KindNumberLit:
+			built[i] = arena.NewNumberLitExpr(NumberLitExpr{ValuePos: pos, Value: str(lhs), Type: node(rhs)})
+		case KindStringLit:
+			built[i] = arena.NewStringLitExpr(StringLitExpr{ValuePos: pos, Value: str(lhs)})
+		case KindBinary:
+			built[i] = arena.NewBinaryExpr(BinaryExpr{X: node(lhs), OpPos: pos, Op: TokenType(tag), Y: node(rhs)})
+		case KindUnary:
+			built[i] = arena.NewUnaryExpr(UnaryExpr{OpPos: pos, Op: TokenType(tag), X: node(lhs)})
+		case KindCall:
+			built[i] = arena.NewCallExpr(CallExpr{Fn: node(lhs), OpenParenPos: pos, Args: exprs(children(rhs)), CloseParenPos: extraPos(rhs)})
+		case KindNull:
+			built[i] = arena.NewNullExpr(NullExpr{Pos: pos, Type: node(lhs)})
+		case KindVoid:
+			built[i] = arena.NewVoidExpr(VoidExpr{Pos: pos})
+		case KindVarRef:
+			built[i] = arena.NewVarRefExpr(VarRefExpr{Pos: pos, Name: str(lhs), Sym: Symbol(rhs)})
+		case KindPrimitiveType:
+			built[i] = arena.NewPrimitiveTypeExpr(PrimitiveTypeExpr{PrimitiveType: TokenType(tag), Pos: pos})
+		case KindPointerType:
+			built[i] = arena.NewPointerTypeExpr(PointerTypeExpr{PointerToType: node(lhs), Pos: pos})
+		case KindInterfaceType:
+			built[i] = arena.NewInterfaceTypeExpr(InterfaceTypeExpr{InterfacePos: pos, Methods: methodLists[stored(lhs, KindMethodList)]})
+		case KindMethodList:
+			methodList := MethodList{Start: pos, End: extraPos(rhs)}
+			if ids := children(rhs); len(ids) > 0 {
+				methodList.Methods = make([]Method, len(ids))
+				for j, method := range ids {
+					methodList.Methods[j] = methods[stored(method, KindMethod)]
+				}
+			}
+			slot[i] = uint32(len(methodLists))
+			methodLists = append(methodLists, methodList)
+		case KindMethod:
+			e := flat.Extra[rhs : rhs+3]
+			slot[i] = uint32(len(methods))
+			methods = append(methods, Method{Name: str(lhs), Sym: Symbol(e[0]), Params: paramLists[stored(e[1], KindParamList)], Return: node(e[2])})
+		case KindStructType:
+			built[i] = arena.NewStructTypeExpr(StructTypeExpr{StructPos: pos, Properties: propertyLists[stored(lhs, KindPropertyList)], Name: str(rhs)})
+		case KindPropertyList:
+			propertyList := PropertyList{Start: pos, End: extraPos(rhs)}
+			if ids := children(rhs); len(ids) > 0 {
+				propertyList.Properties = make([]Property, len(ids))
+				for j, property := range ids {
+					propertyList.Properties[j] = properties[stored(property, KindProperty)]
+				}
+			}
+			slot[i] = uint32(len(propertyLists))
+			propertyLists = append(propertyLists, propertyList)
+		case KindProperty:
+			property := Property{Pub: tag&FlagPub != 0, Mut: tag&FlagMut != 0, Type: node(lhs)}
+			for _, name := range flat.Extra[rhs+1 : rhs+1+flat.Extra[rhs]] {
+				property.Names = append(property.Names, str(name))
+			}
+			slot[i] = uint32(len(properties))
+			properties = append(properties, property)
+		case KindParamList:
+			paramList := ParamList{Start: pos, End: extraPos(rhs)}
+			if ids := children(rhs); len(ids) > 0 {
+				paramList.Params = make([]Param, len(ids))
+				for j, param := range ids {
+					paramList.Params[j] = params[stored(param, KindParam)]
+				}
+			}
+			slot[i] = uint32(len(paramLists))
+			paramLists = append(paramLists, paramList)
+		case KindParam:
+			slot[i] = uint32(len(params))
+			params = append(params, Param{Mut: tag&FlagMut != 0, Type: node(lhs), Name: str(rhs)})
+		case KindExprStmt:
+			built[i] = arena.NewExprStmt(ExprStmt{X: node(lhs)})
+		case KindBlockStmt:
+			block := BlockStmt{Start: pos, Name: str(lhs), End: extraPos(rhs)}
+			if stmts := children(rhs); len(stmts) > 0 {
+				block.List = make([]Stmt, len(stmts))
+				for j, stmt := range stmts {
+					block.List[j] = node(stmt)
+				}
+			}
+			if tag&FlagMaps != 0 {
+				block.Constants = make(map[Symbol]value.Value)
+				block.Mutables = make(map[Symbol]value.Value)
+			}
+			slot[i] = uint32(len(blocks))
+			blocks = append(blocks, block)
+		case KindReturnStmt:
+			built[i] = arena.NewReturnStmt(ReturnStmt{ReturnPos: pos, Type: node(lhs), Value: node(rhs)})
+		case KindFuncReceiver:
+			slot[i] = uint32(len(receivers))
+			receivers = append(receivers, FuncReceiver{Pos: pos, Name: str(lhs), Type: node(rhs)})
+		case KindFuncType:
+			slot[i] = uint32(len(funcTypes))
+			funcTypes = append(funcTypes, FuncType{FuncPos: pos, Params: paramLists[stored(lhs, KindParamList)], Return: node(rhs)})
+		case KindFuncDecl:
+			e := flat.Extra[rhs : rhs+4]
+			fn := FuncDecl{Name: str(lhs), Sym: Symbol(e[0]), FuncType: funcTypes[stored(e[2], KindFuncType)], Body: blocks[stored(e[3], KindBlockStmt)]}
+			if e[1] != NoNode {
+				fn.Receiver = receivers[stored(e[1], KindFuncReceiver)]
+			}
+			built[i] = arena.NewFuncDecl(fn)
+		case KindVarDecl:
+			varDecl := VarDecl{Mut: tag&FlagMut != 0, Type: node(lhs)}
+			n := flat.Extra[rhs]
+			if n > 0 {
+				varDecl.Names = make([]string, n)
+				varDecl.Syms = make([]Symbol, n)
+				for j := uint32(0); j < n; j++ {
+					varDecl.Names[j] = str(flat.Extra[rhs+1+2*j])
+					varDecl.Syms[j] = Symbol(flat.Extra[rhs+2+2*j])
+				}
+			}
+			values := rhs + 1 + 2*n
+			varDecl.Values = exprs(flat.Extra[values+1 : values+1+flat.Extra[values]])
+			built[i] = arena.NewVarDecl(varDecl)
+		case KindTypeDecl:
+			built[i] = arena.NewTypeDecl(TypeDecl{Name: str(lhs), Sym: Symbol(flat.Extra[rhs]), Type: node(flat.Extra[rhs+1])})
+		}
+	}
+
+	nodes = make([]Node, len(flat.Roots))
+	for j, root := range flat.Roots {
+		nodes[j] = node(root)
+	}
+	return nodes, nil
+}
@@ -0,0 +1,171 @@
+package ast
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"hash/crc32"
+)
+
+// Starts every encoded FlatAST, the last byte is the format version and goes up whenever the layout of FlatAST changes
+var flatMagic = [8]byte{'p', 'i', '-', 'a', 's', 't', 0, 2}
+
+const flatHeaderSize = len(flatMagic) + 7*4 // Magic, then the checksum and 6 lengths
+
+var errCorruptFlat = errors.New("corrupt flat AST")
+
+/*
+ * Encode flat as a header followed by each of its arrays in turn, little endian
+ * Nothing needs walking or pointer fixing to read it back, each array is copied in as one block
+ */
+func (flat *FlatAST) MarshalBinary() ([]byte, error) {
+	n := len(flat.Kinds)
+	size := flatHeaderSize + n*(1+1+8+4+4) + 4*(len(flat.Extra)+len(flat.Strings)+len(flat.Roots)+len(flat.Idents)) + len(flat.Text)
+	data := make([]byte, flatHeaderSize, size)
+	copy(data, flatMagic[:])
+	lengths := data[len(flatMagic)+4:]
+	for i, length := range []int{n, len(flat.Extra), len(flat.Text), len(flat.Strings), len(flat.Roots), len(flat.Idents)} {
+		binary.LittleEndian.PutUint32(lengths[i*4:], uint32(length))
+	}
+
+	data = append(data, flat.Tags...)
+	for _, kind := range flat.Kinds {
+		data = append(data, byte(kind))
+	}
+	for _, pos := range flat.Pos {
+		data = appendUint32s(data, uint32(pos.Row), uint32(pos.Col))
+	}
+	data = appendUint32s(data, flat.Lhs...)
+	data = appendUint32s(data, flat.Rhs...)
+	data = appendUint32s(data, flat.Extra...)
+	data = appendUint32s(data, flat.Strings...)
+	data = appendUint32s(data, flat.Roots...)
+	data = appendUint32s(data, flat.Idents...)
+	data = append(data, flat.Text...)
+
+	binary.LittleEndian.PutUint32(data[len(flatMagic):], crc32.ChecksumIEEE(data[flatHeaderSize:]))
+	return data, nil
+}
+
+func appendUint32s(data []byte, words ...uint32) []byte {
+	start := len(data)
+	data = append(data, make([]byte, 4*len(words))...)
+	for i, word := range words {
+		binary.LittleEndian.PutUint32(data[start+i*4:], word)
+	}
+	return data
+}
+
+// Decode what MarshalBinary encoded into flat, replacing what was in it
+func (flat *FlatAST) UnmarshalBinary(data []byte) error {
+	if len(data) < flatHeaderSize || string(data[:len(flatMagic)]) != string(flatMagic[:]) {
+		return fmt.Errorf("not a flat AST or from another version of the format")
+	}
+	if crc32.ChecksumIEEE(data[flatHeaderSize:]) != binary.LittleEndian.Uint32(data[len(flatMagic):]) {
+		return errCorruptFlat
+	}
+	var lengths [6]int
+	for i := range lengths {
+		lengths[i] = int(binary.LittleEndian.Uint32(data[len(flatMagic)+4+i*4:]))
+	}
+	n, extra, text, strings, roots, idents := lengths[0], lengths[1], lengths[2], lengths[3], lengths[4], lengths[5]
+	if len(data) != flatHeaderSize+n*(1+1+8+4+4)+4*(extra+strings+roots+idents)+text || strings == 0 {
+		return errCorruptFlat
+	}
+
+	rest := data[flatHeaderSize:]
+	take := func(size int) []byte {
+		block := rest[:size:size]
+		rest = rest[size:]
+		return block
+	}
+	*flat = FlatAST{}
+	flat.Tags = append([]uint8(nil), take(n)...)
+	flat.Kinds = make([]NodeKind, n)
+	for i, kind := range take(n) {
+		flat.Kinds[i] = NodeKind(kind)
+	}
+	pos := readUint32s(take(8 * n))
+	flat.Pos = make([]FlatPos, n)
+	for i := range flat.Pos {
+		flat.Pos[i] = FlatPos{Row: int32(pos[2*i]), Col: int32(pos[2*i+1])}
+	}
+	flat.Lhs = readUint32s(take(4 * n))
+	flat.Rhs = readUint32s(take(4 * n))
+	flat.Extra = readUint32s(take(4 * extra))
+	flat.Strings = readUint32s(take(4 * strings))
+	flat.Roots = readUint32s(take(4 * roots))
+	flat.Idents = readUint32s(take(4 * idents))
+	flat.Text = append([]byte(nil), take(text)...)
+
+	for i := 1; i < len(flat.Strings); i++ {
+		if flat.Strings[i] < flat.Strings[i-1] || int(flat.Strings[i]) > len(flat.Text) {
+			return errCorruptFlat
+		}
+	}
+	for _, root := range flat.Roots {
+		if int(root) >= n {
+			return errCorruptFlat
+		}
+	}
+	for _, name := range flat.Idents {
+		if int(name) >= strings-1 {
+			return errCorruptFlat
+		}
+	}
+	return nil
+}
+
+func readUint32s(data []byte) []uint32 {
+	if len(data) == 0 {
+		return nil
+	}
+	words := make([]uint32, len(data)/4)
+	for i := range words {
+		words[i] = binary.LittleEndian.Uint32(data[i*4:])
+	}
+	return words
+}
+
+/*
+ * Swap every Symbol in flat for the one symbols gives its name
+ * Symbols are only meaningful to the Interner they came from, so this is needed before using a FlatAST read from somewhere else
+ * Idents are interned first, so they get the same Symbols lexing the source would have given them
+ */
+func (flat *FlatAST) Reintern(symbols *Interner) (err error) {
+	defer func() {
+		if r := recover(); r != nil {
+			err = fmt.Errorf("corrupt flat AST: %v", r)
+		}
+	}()
+
+	syms := make([]Symbol, len(flat.Strings)-1) // By string, 0 until it's interned
+	symOf := func(name uint32) Symbol {
+		if syms[name] == 0 {
+			syms[name] = symbols.Intern(flat.Text[flat.Strings[name]:flat.Strings[name+1]])
+		}
+		return syms[name]
+	}
+	for _, name := range flat.Idents {
+		symOf(name)
+	}
+	intern := func(name uint32, sym *uint32) {
+		if *sym != 0 {
+			*sym = uint32(symOf(name))
+		}
+	}
+	for i, kind := range flat.Kinds {
+		lhs, rhs := flat.Lhs[i], flat.Rhs[i]
+		switch kind {
+		case KindIdentifier, KindVarRef:
+			intern(lhs, &flat.Rhs[i])
+		case KindMethod, KindFuncDecl, KindTypeDecl:
+			intern(lhs, &flat.Extra[rhs])
+		case KindVarDecl:
+			for j := uint32(0); j < flat.Extra[rhs]; j++ {
+				intern(flat.Extra[rhs+1+2*j], &flat.Extra[rhs+2+2*j])
+			}
+		}
+	}
+	return nil
+}
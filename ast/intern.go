@@ -0,0 +1,41 @@
+package ast
+
+// The dense ID of an interned identifier, 0 is never given out so it can mean 'no symbol'
+type Symbol uint32
+
+/*
+ * Gives every distinct identifier in a compilation one Symbol and one string
+ * The lexer fills it, the parser and codegen key their tables on the Symbols
+ */
+type Interner struct {
+	IDs   map[string]Symbol
+	Names []string // Names[sym] is the identifier sym was given for
+}
+
+func (interner *Interner) Intern(name []byte) Symbol {
+	if sym, ok := interner.IDs[string(name)]; ok {
+		return sym
+	}
+	if interner.IDs == nil {
+		interner.IDs = make(map[string]Symbol)
+		interner.Names = []string{""}
+	}
+
+	str := string(name)
+	sym := Symbol(len(interner.Names))
+	interner.Names = append(interner.Names, str)
+	interner.IDs[str] = sym
+	return sym
+}
+
+func (interner *Interner) Name(sym Symbol) string {
+	return interner.Names[sym]
+}
+
+// One more than the largest Symbol given out, for sizing tables indexed by Symbol
+func (interner *Interner) Len() int {
+	if interner.Names == nil {
+		return 1
+	}
+	return len(interner.Names)
+}
@@ -0,0 +1,448 @@
+/*
+ * Generates lexer_tables.go, the tables of the DFA the lexer runs, from tokens.spec
+ * Run it with `go generate ./ast`
+ *
+ * Every state of the DFA is either idle or in the middle of a token, which token it is is the state's Accept
+ * A transition can act on the byte it reads (emit the token being read, start a new one, ...), see the action* flags
+ * Bytes that every state treats the same are folded into one class so a row of the table is only as wide as the number of classes
+ */
+package main
+
+import (
+	"bufio"
+	"bytes"
+	"fmt"
+	"go/format"
+	"io/ioutil"
+	"os"
+	"sort"
+	"strings"
+)
+
+// What a transition does before moving to its next state, the lexer has the same flags as dfa*
+const (
+	actionEmit      = 1 << iota // Add the token being read, it ends just before this byte
+	actionSplit                 // Like actionEmit, but the token's last byte is added as a token of its own
+	actionStartHere             // A token starts at this byte
+	actionStartNext             // A token starts just after this byte
+	actionNewLine               // This byte is a newline
+	actionSkip                  // Jump ahead to the next byte the next state cares about (the end of a string or comment)
+)
+
+// Index of the end of input in a state's transitions
+const classEOF = 256
+
+const (
+	maxStates  = 256 // Transitions store their next state in a byte
+	maxClasses = 255 // Classes are stored in a byte and the end of input needs one too
+)
+
+type token struct {
+	Name   string
+	Text   string
+	Single bool
+}
+
+type transition struct {
+	To    *state
+	Flags int
+}
+
+type state struct {
+	Index  int
+	Name   string
+	Accept string // TokenType of the token being read in this state, "" if there isn't one
+	Next   [classEOF + 1]transition
+}
+
+type generator struct {
+	Tokens []token
+	Single [256]string // Name of the single byte token of every byte that ends a word
+	States []*state
+	Trie   map[string]*state // States that are partway through a word keyword or a token like '->', by what has been read so far
+
+	Normal, Ident, Number, NumberDot *state
+	Minus, MinusAfterWord, Dot       *state
+	Plain                            [256]*state // Single byte tokens that can't become anything longer on their own
+}
+
+func main() {
+	g := &generator{Trie: map[string]*state{}}
+	if err := g.ReadSpec("tokens.spec"); err != nil {
+		fatal(err)
+	}
+	if err := g.Build(); err != nil {
+		fatal(err)
+	}
+	src, err := g.Generate()
+	if err != nil {
+		fatal(err)
+	}
+	if err := ioutil.WriteFile("lexer_tables.go", src, 0644); err != nil {
+		fatal(err)
+	}
+}
+
+func fatal(err error) {
+	fmt.Fprintln(os.Stderr, "dfagen:", err)
+	os.Exit(1)
+}
+
+func (g *generator) ReadSpec(path string) error {
+	f, err := os.Open(path)
+	if err != nil {
+		return err
+	}
+	defer f.Close()
+
+	scanner := bufio.NewScanner(f)
+	for row := 1; scanner.Scan(); row++ {
+		fields := strings.Fields(scanner.Text())
+		if len(fields) == 0 || strings.HasPrefix(fields[0], "#") {
+			continue
+		}
+		tok := token{Name: fields[0]}
+		if len(fields) > 1 {
+			tok.Text = fields[1]
+		}
+		if len(fields) > 2 {
+			tok.Single = fields[2] == "single"
+		}
+		if tok.Text == "" || len(fields) > 3 || (len(fields) == 3 && !tok.Single) {
+			return fmt.Errorf("%s:%d: expected 'Name text [single]'", path, row)
+		}
+		if tok.Single && len(tok.Text) != 1 {
+			return fmt.Errorf("%s:%d: single tokens have to be one byte", path, row)
+		}
+		if tok.Single {
+			g.Single[tok.Text[0]] = tok.Name
+		}
+		g.Tokens = append(g.Tokens, tok)
+	}
+	if err := scanner.Err(); err != nil {
+		return err
+	}
+
+	// These take part in comments, negative numbers and decimals, so they're wired up by hand below
+	for _, c := range "/-." {
+		if g.Single[c] == "" {
+			return fmt.Errorf("%s: '%c' has to be a single token", path, c)
+		}
+	}
+	for _, tok := range g.Tokens {
+		if tok.Single {
+			continue
+		}
+		// A digit would make a word a number, and '-' or '.' followed by one start a number too
+		text := tok.Text
+		if g.Glued(tok) {
+			text = text[1:]
+		} else if isDigit(text[0]) {
+			return fmt.Errorf("%s: '%s' would be read as a number", path, tok.Text)
+		}
+		for i := 0; i < len(text); i++ {
+			if !g.IsWordByte(text[i]) || g.Glued(tok) && isDigit(text[i]) {
+				return fmt.Errorf("%s: '%s' can't be read as one token", path, tok.Text)
+			}
+		}
+	}
+	return nil
+}
+
+// Whether tok starts with a single byte token, it's read as one token even right after a word
+func (g *generator) Glued(tok token) bool {
+	return !tok.Single && g.Single[tok.Text[0]] != ""
+}
+
+func (g *generator) IsWordByte(c byte) bool {
+	return !isSpace(c) && g.Single[c] == "" && c != '"'
+}
+
+func (g *generator) AddState(name, accept string) *state {
+	s := &state{Index: len(g.States), Name: name, Accept: accept}
+	g.States = append(g.States, s)
+	return s
+}
+
+func (g *generator) Build() error {
+	// The first states are the ones LexerState has names for
+	g.Normal = g.AddState("Normal", "")
+	str := g.AddState("String", "StringLiteral")
+	lineComment := g.AddState("LineComment", "")
+	blockComment := g.AddState("BlockComment", "")
+
+	strEscape := g.AddState("StringEscape", "StringLiteral")
+	blockStar := g.AddState("BlockCommentStar", "")
+	slash := g.AddState("Slash", g.Single['/'])
+	g.Minus = g.AddState("Minus", g.Single['-']) // Can still turn out to be the sign of a number
+	g.MinusAfterWord = g.AddState("MinusAfterWord", g.Single['-'])
+	g.Dot = g.AddState("Dot", g.Single['.']) // Can still turn out to be the start of a number
+	g.NumberDot = g.AddState("NumberDot", "NumberLiteral")
+	g.Number = g.AddState("Number", "NumberLiteral")
+	g.Ident = g.AddState("Identifier", "Identifier")
+	for c := 0; c < 256; c++ {
+		if g.Single[c] != "" && c != '/' && c != '-' {
+			g.Plain[c] = g.AddState(g.Single[c], g.Single[c])
+		}
+	}
+
+	var prefixes []string
+	accepts := map[string]string{}
+	for _, tok := range g.Tokens {
+		if tok.Single {
+			continue
+		}
+		first := 1
+		if g.Glued(tok) {
+			first = 2
+		}
+		for n := first; n <= len(tok.Text); n++ {
+			prefix := tok.Text[:n]
+			if _, ok := accepts[prefix]; !ok {
+				prefixes = append(prefixes, prefix)
+				accepts[prefix] = ""
+			}
+		}
+		accepts[tok.Text] = tok.Name
+	}
+	sort.Strings(prefixes)
+	for _, prefix := range prefixes {
+		accept := accepts[prefix]
+		if accept == "" {
+			if g.Single[prefix[0]] != "" {
+				return fmt.Errorf("'%s' has to be a token since a longer token starts with it", prefix)
+			}
+			accept = "Identifier"
+		}
+		g.Trie[prefix] = g.AddState("'"+prefix+"'", accept)
+	}
+
+	if len(g.States) > maxStates {
+		return fmt.Errorf("%d states is too many, transitions only have room for %d", len(g.States), maxStates)
+	}
+
+	n := g.Normal
+	for c := 0; c < 256; c++ {
+		b := byte(c)
+		switch {
+		case b == '\n':
+			n.Set(c, n, actionNewLine)
+		case isSpace(b):
+			n.Set(c, n, 0)
+		case b == '"':
+			n.Set(c, str, actionStartNext|actionSkip)
+		case b == '/':
+			n.Set(c, slash, actionStartHere)
+		case b == '-':
+			n.Set(c, g.Minus, actionStartHere)
+		case b == '.':
+			n.Set(c, g.Dot, actionStartHere)
+		case g.Single[c] != "":
+			n.Set(c, g.Plain[c], actionStartHere)
+		case isDigit(b):
+			n.Set(c, g.Number, actionStartHere)
+		default:
+			n.Set(c, g.WordState("", b), actionStartHere)
+		}
+	}
+	n.Set(classEOF, n, 0)
+
+	for _, s := range []*state{str, strEscape} {
+		s.SetAll(str, actionSkip)
+		s.Set('\n', str, actionNewLine)
+		s.Set(classEOF, n, actionEmit)
+	}
+	str.Set('"', n, actionEmit)
+	str.Set('\\', strEscape, 0)
+
+	lineComment.SetAll(lineComment, actionSkip)
+	lineComment.Set('\n', n, actionNewLine)
+	lineComment.Set(classEOF, lineComment, 0)
+
+	for _, s := range []*state{blockComment, blockStar} {
+		s.SetAll(blockComment, actionSkip)
+		s.Set('*', blockStar, 0)
+		s.Set('\n', blockComment, actionNewLine)
+		s.Set(classEOF, blockComment, 0)
+	}
+	blockStar.Set('/', n, 0)
+
+	g.Terminate(slash, actionEmit)
+	slash.Set('/', lineComment, actionSkip)
+	slash.Set('*', blockComment, actionSkip)
+
+	// '-' and '.' followed by a digit start a number, unless they come right after a word
+	g.Terminate(g.Minus, actionEmit)
+	g.Terminate(g.MinusAfterWord, actionEmit)
+	g.Terminate(g.Dot, actionEmit)
+	g.Terminate(g.NumberDot, actionSplit) // '1.x' is a number and a period
+	for c := '0'; c <= '9'; c++ {
+		g.Minus.Set(int(c), g.Number, 0)
+		g.Dot.Set(int(c), g.Number, 0)
+		g.NumberDot.Set(int(c), g.Number, 0)
+	}
+	g.Continue(g.Minus, "-")
+	g.Continue(g.MinusAfterWord, "-")
+	for c := 0; c < 256; c++ {
+		if g.Plain[c] != nil {
+			g.Terminate(g.Plain[c], actionEmit)
+			g.Continue(g.Plain[c], string(byte(c)))
+		}
+	}
+
+	g.Word(g.Ident, "")
+	g.Word(g.Number, "")
+	g.Number.Set('.', g.NumberDot, 0)
+	for _, prefix := range prefixes {
+		s := g.Trie[prefix]
+		if g.Single[prefix[0]] != "" {
+			g.Terminate(s, actionEmit)
+			g.Continue(s, prefix)
+		} else {
+			g.Word(s, prefix)
+		}
+	}
+	return nil
+}
+
+func (s *state) Set(c int, to *state, flags int) {
+	s.Next[c] = transition{To: to, Flags: flags}
+}
+
+func (s *state) SetAll(to *state, flags int) {
+	for c := 0; c < 256; c++ {
+		s.Set(c, to, flags)
+	}
+}
+
+// Make every byte end the token being read in s and then be read like it would be in Normal
+func (g *generator) Terminate(s *state, emit int) {
+	for c := range s.Next {
+		next := g.Normal.Next[c]
+		s.Set(c, next.To, next.Flags|emit)
+	}
+}
+
+// Let s, which has read prefix, go on to read any longer token that starts with prefix
+func (g *generator) Continue(s *state, prefix string) {
+	for c := 0; c < 256; c++ {
+		if next, ok := g.Trie[prefix+string(byte(c))]; ok {
+			s.Set(c, next, 0)
+		}
+	}
+}
+
+// Make s, which has read prefix of a word, go on reading the word until something ends it
+func (g *generator) Word(s *state, prefix string) {
+	g.Terminate(s, actionEmit)
+	for c := 0; c < 256; c++ {
+		b := byte(c)
+		if !g.IsWordByte(b) {
+			continue
+		}
+		switch s {
+		case g.Ident:
+			s.Set(c, g.Ident, 0)
+		case g.Number:
+			s.Set(c, g.Number, 0)
+		default:
+			s.Set(c, g.WordState(prefix, b), 0)
+		}
+	}
+	s.Set('-', g.MinusAfterWord, actionEmit|actionStartHere)
+	s.Set('.', g.Plain['.'], actionEmit|actionStartHere)
+}
+
+// The state a word that starts with prefix is in after reading c
+func (g *generator) WordState(prefix string, c byte) *state {
+	if s, ok := g.Trie[prefix+string(c)]; ok {
+		return s
+	}
+	return g.Ident
+}
+
+func (g *generator) Generate() ([]byte, error) {
+	// Bytes with the same column in every state share a class
+	var classOf [256]int
+	var classes []int // First byte of every class
+	columns := map[string]int{}
+	for c := 0; c < 256; c++ {
+		var key strings.Builder
+		for _, s := range g.States {
+			fmt.Fprintf(&key, "%d:%d,", s.Next[c].To.Index, s.Next[c].Flags)
+		}
+		class, ok := columns[key.String()]
+		if !ok {
+			class = len(classes)
+			columns[key.String()] = class
+			classes = append(classes, c)
+		}
+		classOf[c] = class
+	}
+	if len(classes) > maxClasses {
+		return nil, fmt.Errorf("%d byte classes is too many, there's only room for %d", len(classes), maxClasses)
+	}
+
+	var buf bytes.Buffer
+	fmt.Fprintf(&buf, "// Code generated by internal/dfagen from tokens.spec; DO NOT EDIT.\n\npackage ast\n\n")
+
+	fmt.Fprintf(&buf, "// Every token that is recognized by its exact text\nvar keywords = [...]struct {\nText string\nTokenType TokenType\n}{\n")
+	for _, tok := range g.Tokens {
+		fmt.Fprintf(&buf, "{%q, TokenType%s},\n", tok.Text, tok.Name)
+	}
+	fmt.Fprintf(&buf, "}\n\n")
+
+	fmt.Fprintf(&buf, "const (\n")
+	names := []string{"dfaEmit", "dfaSplit", "dfaStartHere", "dfaStartNext", "dfaNewLine", "dfaSkip"}
+	for i, name := range names {
+		fmt.Fprintf(&buf, "%s = %d\n", name, 1<<i)
+	}
+	fmt.Fprintf(&buf, "\ndfaStateCount = %d\ndfaClassCount = %d // Including the end of input\ndfaClassEOF = %d\n\n", len(g.States), len(classes)+1, len(classes))
+	fmt.Fprintf(&buf, "// States that read the rest of a word, every word byte keeps them where they are without doing anything\n")
+	fmt.Fprintf(&buf, "dfaIdentifier = %d\ndfaNumber = %d\n)\n\n", g.Ident.Index, g.Number.Index)
+
+	fmt.Fprintf(&buf, "// The class of every byte\nvar dfaClasses = [256]uint8{")
+	for c := 0; c < 256; c++ {
+		if c%16 == 0 {
+			fmt.Fprintf(&buf, "\n")
+		}
+		fmt.Fprintf(&buf, "%d, ", classOf[c])
+	}
+	fmt.Fprintf(&buf, "\n}\n\n")
+
+	fmt.Fprintf(&buf, "// The TokenType of the token being read in every state\nvar dfaAccept = [dfaStateCount]uint8{\n")
+	for _, s := range g.States {
+		accept := s.Accept
+		if accept == "" {
+			accept = "EOF" // Never emitted
+		}
+		fmt.Fprintf(&buf, "uint8(TokenType%s), // %s\n", accept, s.Name)
+	}
+	fmt.Fprintf(&buf, "}\n\n")
+
+	fmt.Fprintf(&buf, "/*\n * Row of dfaClassCount transitions for every state\n")
+	fmt.Fprintf(&buf, " * The low byte of a transition is its next state and the high byte is its dfa* flags\n */\n")
+	fmt.Fprintf(&buf, "var dfaTransitions = [dfaStateCount * dfaClassCount]uint16{\n")
+	for _, s := range g.States {
+		fmt.Fprintf(&buf, "// %s\n", s.Name)
+		for i, c := range append(classes, classEOF) {
+			if i > 0 && i%16 == 0 {
+				fmt.Fprintf(&buf, "\n")
+			}
+			next := s.Next[c]
+			fmt.Fprintf(&buf, "%#04x, ", next.To.Index|next.Flags<<8)
+		}
+		fmt.Fprintf(&buf, "\n")
+	}
+	fmt.Fprintf(&buf, "}\n")
+
+	return format.Source(buf.Bytes())
+}
+
+func isSpace(c byte) bool {
+	return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f'
+}
+
+func isDigit(c byte) bool {
+	return c >= '0' && c <= '9'
+}
@@ -0,0 +1,13 @@
+package ast
+
+// keywords is generated from tokens.spec, see lexer_tables.go, the DFA matches them so they're never looked up
+
+// The text of every token type that is always spelled the same way
+var tokenTexts [TokenTypeEOF + 1]string
+
+func init() {
+	for _, kw := range keywords {
+		tokenTexts[kw.TokenType] = kw.Text
+	}
+	tokenTexts[TokenTypeEOF] = "EOF"
+}
@@ -0,0 +1,33 @@
+package ast
+
+// Parses a function body that was skipped the first time around
+type BodyParser interface {
+	ParseBody(fn *FuncDecl) (BlockStmt, error)
+}
+
+/*
+ * A function body that hasn't been parsed yet, just the range of tokens it covers
+ * Anything that only needs signatures (interface checks, symbol indexes) never pays for parsing it
+ */
+type LazyBody struct {
+	Start, End int  // Token range of the body, braces included
+	Type       Expr // What number literals default to at the start of the body
+	Parser     BodyParser
+}
+
+/*
+ * Parse fn's body if it was skipped, Body is complete after this
+ * Bodies are expanded in place, so this isn't safe to call on the same FuncDecl from more than one goroutine
+ */
+func (fn *FuncDecl) ExpandBody() error {
+	if fn.Lazy == nil {
+		return nil
+	}
+	body, err := fn.Lazy.Parser.ParseBody(fn)
+	if err != nil {
+		return err
+	}
+	fn.Body = body
+	fn.Lazy = nil
+	return nil
+}
@@ -1,8 +1,13 @@
 package ast
 
+//go:generate go run ./internal/dfagen
+
 import (
+	"bytes"
+	"fmt"
+	"math"
+	"sort"
 	"strings"
-	"unicode"
 
 	"github.com/IbrahimFadel/pi-lang/utils"
 )
@@ -88,7 +93,10 @@ const (
 	LexerStateBlockComment
 )
 
-var singleCharTokens = [...]byte{'(', ')', ';', ',', '.', '+', '*', '/', '-'}
+var blockCommentEnd = []byte("*/")
+
+// Number of tokens NextToken lets pile up in Spans before moving them back to the front
+const maxLookahead = 64
 
 type TokenPos struct {
 	Row, Col int
@@ -98,289 +106,407 @@ type Token struct {
 	TokenType TokenType
 	Value     string
 	Pos       TokenPos
+	Sym       Symbol // Only set for identifiers
 }
 
-type Lexer struct {
-	Tokens []Token
-	Pos    TokenPos
-	State  LexerState
-	Line   string
+/*
+ * A token packed into 12 bytes that refers back into Lexer.Src instead of owning a copy of its text
+ * Its position isn't stored, Lexer.PosOf works it out from Lexer.Lines when it's needed
+ */
+type Span struct {
+	Start uint32
+	Len   uint32
+	Kind  uint8 // TokenType
+}
 
-	Token string // Current token (gets chars appended to it as it reads the file, and gets added to Tokens and reset often)
+func (span Span) TokenType() TokenType {
+	return TokenType(span.Kind)
 }
 
+func (span Span) End() int {
+	return int(span.Start + span.Len)
+}
+
+type Lexer struct {
+	Tokens  []Token
+	Spans   []Span
+	Syms    []Symbol // Syms[i] is the Symbol of Spans[i] once NextToken or PeekToken has interned it, 0 until then
+	Src     []byte
+	Lines   []uint32  // Offset of the first byte of every line read so far
+	Symbols *Interner // Identifiers are interned here, share it between lexers to share Symbols
+	Idents  []Symbol  // Identifiers in the order they were first made into tokens since Reset
+	State   LexerState
+
+	Offset   int // Offset of the next byte to read
+	Head     int // Index in Spans of the next token NextToken returns
+	TokStart int // Offset of the first byte of the token being read, or -1 if there isn't one
+
+	identSeen []bool // By Symbol, whether it's in Idents
+}
+
+// Tokenize the lines of a file and fill Tokens
 func (lexer *Lexer) Tokenize(content []string) {
-	lexer.Tokens = nil
-	lexer.Pos.Row = 1
-	lexer.Pos.Col = 1
-	lexer.Token = ""
+	lexer.TokenizeBuffer([]byte(strings.Join(content, "")))
+	lexer.FillTokens()
+}
+
+/*
+ * Tokenize one contiguous source buffer and fill Spans
+ * No token text is copied, use Value to get it
+ * Spans' memory is reused by the next call
+ */
+func (lexer *Lexer) TokenizeBuffer(src []byte) {
+	if lexer.Spans == nil {
+		lexer.Spans = make([]Span, 0, len(src)/8+1)
+	}
+	lexer.Reset(src)
+	// One pass over the whole buffer, Scan only has to finish the last token and add EOF
+	lexer.ScanUntil(int(^uint(0) >> 1))
+	for lexer.Scan() {
+	}
+}
+
+// Start reading src from the beginning, dropping every span read so far
+func (lexer *Lexer) Reset(src []byte) {
+	if uint64(len(src)) > math.MaxUint32 {
+		utils.FatalError(fmt.Sprintf("source is too large to be lexed (%d bytes)", len(src)))
+	}
+	if lexer.Symbols == nil {
+		lexer.Symbols = &Interner{}
+	}
+	lexer.Src = src
+	lexer.Spans = lexer.Spans[:0]
+	lexer.Syms = lexer.Syms[:0]
+	for _, sym := range lexer.Idents {
+		lexer.identSeen[sym] = false
+	}
+	lexer.Idents = lexer.Idents[:0]
+	lexer.Lines = append(lexer.Lines[:0], 0)
+	lexer.Head = 0
+	lexer.Offset = 0
+	lexer.TokStart = -1
 	lexer.State = LexerStateNormal
+}
 
-	for _, line := range content {
-		lexer.Line = line
-		for i := 0; i < len(line); i++ {
-			c := line[i]
-			shouldContinue := lexer.UpdateState(c, &i)
-			if shouldContinue {
-				continue
-			}
+/*
+ * Read until at least one more span has been appended to Spans
+ * Returns false once the EOF span has been appended
+ */
+func (lexer *Lexer) Scan() bool {
+	src := lexer.Src
+	if lexer.Offset > len(src) {
+		return false
+	}
 
-			if lexer.State == LexerStateString {
-				lexer.Token += string(c)
-				continue
-			}
+	n := len(lexer.Spans)
+	lexer.ScanUntil(n + 1)
+	if len(lexer.Spans) > n {
+		return true
+	}
+
+	lexer.Finish()
+	lexer.AddSpan(TokenTypeEOF, len(src), len(src))
+	lexer.Offset = len(src) + 1
+	return false
+}
+
+// Bytes that keep the identifier and number states where they are without doing anything
+var identBytes, numberBytes [256]bool
 
-			if c == '\n' || c == ' ' {
-				lexer.AddTokenIfValid('\x00')
-			} else if utils.ContainsByte(singleCharTokens[:], c) {
-				// Some single char tokens are special
-				// '-' can either be a 'minus' or the beginning of an '->' operator
-				if c == '-' {
-					if lexer.Line[i+1] == '>' {
-						lexer.AddTokenIfValid('\x00')
-						lexer.Token += "->"
-						lexer.AddTokenIfValid('\x00')
-						i++
-						continue
-					} else if utils.IsNumber(string(lexer.Line[i+1])) {
-						lexer.Token += string(c)
-						continue
-					} else {
-						lexer.AddTokenIfValid(c)
-						continue
-					}
-				} else if c == '.' && utils.IsNumber(string(lexer.Line[i+1])) {
-					// This handles decimal numbers
-					lexer.Token += string(c)
-					continue
-				} else {
-					// If it's not a special single char token, just add it normally
-					lexer.AddTokenIfValid(c)
-					continue
-				}
+func init() {
+	for c := range identBytes {
+		class := int(dfaClasses[c])
+		identBytes[c] = dfaTransitions[dfaIdentifier*dfaClassCount+class] == dfaIdentifier
+		numberBytes[c] = dfaTransitions[dfaNumber*dfaClassCount+class] == dfaNumber
+	}
+}
+
+/*
+ * Read from Offset until Spans has grown to limit or the end of Src
+ * This runs the DFA in lexer_tables.go, every byte is one lookup in dfaTransitions and only the transitions that do something leave the loop
+ * The rest of an identifier or number is only a check of identBytes or numberBytes per byte
+ * Ending a token and starting the next is nearly all of the transitions that do something, so that's done here and Act only gets the rest
+ */
+func (lexer *Lexer) ScanUntil(limit int) {
+	src := lexer.Src
+	state := lexer.State
+	spans, tokStart := lexer.Spans, lexer.TokStart
+	i := lexer.Offset
+	for i < len(src) {
+		if state == dfaIdentifier {
+			for i < len(src) && identBytes[src[i]] {
+				i++
+			}
+		} else if state == dfaNumber {
+			for i < len(src) && numberBytes[src[i]] {
+				i++
 			}
+		}
+		if i == len(src) {
+			break
+		}
 
-			lexer.Token += string(c)
-			lexer.Pos.Col++
+		t := dfaTransitions[int(state)*dfaClassCount+int(dfaClasses[src[i]])]
+		from := state
+		state = LexerState(t & 0xff)
+		flags := t >> 8
+		if flags == 0 {
+			i++
+			continue
+		}
+		if flags&^(dfaEmit|dfaStartHere) == 0 {
+			if flags&dfaEmit != 0 {
+				spans = append(spans, Span{Start: uint32(tokStart), Len: uint32(i - tokStart), Kind: dfaAccept[from]})
+			}
+			tokStart = -1
+			if flags&dfaStartHere != 0 {
+				tokStart = i
+			}
+			i++
+		} else {
+			lexer.Spans, lexer.TokStart = spans, tokStart
+			i = lexer.Act(t, from, i)
+			spans, tokStart = lexer.Spans, lexer.TokStart
+		}
+		if len(spans) >= limit {
+			break
 		}
-		lexer.Pos.Row++
-		lexer.Pos.Col = 1
 	}
+	lexer.Spans, lexer.TokStart = spans, tokStart
+	lexer.State = state
+	lexer.Offset = i
+}
 
-	eofTok := Token{
-		Pos:       TokenPos{-1, -1},
-		Value:     "EOF",
-		TokenType: TokenTypeEOF,
+// Emit the token being read when Src ends
+func (lexer *Lexer) Finish() {
+	n := len(lexer.Src)
+	if t := dfaTransitions[int(lexer.State)*dfaClassCount+dfaClassEOF]; t>>8 != 0 {
+		lexer.Act(t, lexer.State, n)
 	}
-	lexer.Tokens = append(lexer.Tokens, eofTok)
+	lexer.State = LexerStateNormal
 }
 
-func (lexer *Lexer) UpdateState(c byte, i *int) bool {
-	switch lexer.State {
-	case LexerStateNormal:
-		if c == '"' {
-			lexer.State = LexerStateString
-			return true
-		} else if c == '/' && lexer.Line[*i+1] == '/' {
-			lexer.State = LexerStateLineComment
-			*i++
-			return true
-		} else if c == '/' && lexer.Line[*i+1] == '*' {
-			lexer.State = LexerStateBlockComment
-			*i++
-			return true
+/*
+ * Carry out the actions of the transition t out of state 'from' on the byte at i
+ * Returns the offset of the next byte to read
+ */
+func (lexer *Lexer) Act(t uint16, from LexerState, i int) int {
+	flags := t >> 8
+	if flags&(dfaEmit|dfaSplit) != 0 {
+		kind := TokenType(dfaAccept[from])
+		if flags&dfaSplit != 0 {
+			// The last byte is read again on its own, like '.' in '1.x'
+			last := dfaTransitions[int(LexerStateNormal)*dfaClassCount+int(dfaClasses[lexer.Src[i-1]])]
+			lexer.AddSpan(kind, lexer.TokStart, i-1)
+			lexer.AddSpan(TokenType(dfaAccept[last&0xff]), i-1, i)
+		} else {
+			lexer.AddSpan(kind, lexer.TokStart, i)
 		}
+		lexer.TokStart = -1
+	}
+	if flags&dfaStartHere != 0 {
+		lexer.TokStart = i
+	} else if flags&dfaStartNext != 0 {
+		lexer.TokStart = i + 1
+	}
+	if flags&dfaNewLine != 0 {
+		lexer.NewLine(i)
+	}
+	if flags&dfaSkip != 0 {
+		return lexer.Skip(LexerState(t&0xff), i+1)
+	}
+	return i + 1
+}
+
+/*
+ * Offset of the next byte at or after i that matters in a string or comment
+ * Everything in between is skipped in bulk instead of going through the DFA a byte at a time
+ */
+func (lexer *Lexer) Skip(state LexerState, i int) int {
+	switch state {
 	case LexerStateString:
-		if c == '"' && lexer.Line[*i-1] != '\\' {
-			lexer.AddTokenIfValid('\x00')
-			lexer.State = LexerStateNormal
-			return true
-		}
+		return lexer.SkipString(i)
 	case LexerStateLineComment:
-		if c != '\n' {
-			return true
-		}
-		lexer.State = LexerStateNormal
-		return true
+		return lexer.IndexFrom(i, '\n')
 	case LexerStateBlockComment:
-		if c == '*' && lexer.Line[*i+1] == '/' {
-			lexer.State = LexerStateNormal
-			*i++
-			return true
+		end := len(lexer.Src)
+		if i < end {
+			if n := bytes.Index(lexer.Src[i:], blockCommentEnd); n != -1 {
+				end = i + n
+			}
 		}
-		return true
+		lexer.SkipLines(i, end)
+		return end
 	}
-	return false
+	return i
 }
 
-func (lexer *Lexer) AddTokenIfValid(c byte) {
-	// Strip whitespace
-	if lexer.State != LexerStateString {
-		lexer.Token = strings.Map(func(r rune) rune {
-			if unicode.IsSpace(r) {
-				return -1
-			}
-			return r
-		}, lexer.Token)
-	}
-
-	var tok Token
-
-	switch lexer.Token {
-	case "i64":
-		tok = lexer.ConstructToken(TokenTypeI64)
-	case "u64":
-		tok = lexer.ConstructToken(TokenTypeU64)
-	case "i32":
-		tok = lexer.ConstructToken(TokenTypeI32)
-	case "u32":
-		tok = lexer.ConstructToken(TokenTypeU32)
-	case "i16":
-		tok = lexer.ConstructToken(TokenTypeI16)
-	case "u16":
-		tok = lexer.ConstructToken(TokenTypeU16)
-	case "i8":
-		tok = lexer.ConstructToken(TokenTypeI8)
-	case "u8":
-		tok = lexer.ConstructToken(TokenTypeU8)
-	case "f64":
-		tok = lexer.ConstructToken(TokenTypeF64)
-	case "f32":
-		tok = lexer.ConstructToken(TokenTypeF32)
-	case "bool":
-		tok = lexer.ConstructToken(TokenTypeBool)
-	case "string":
-		tok = lexer.ConstructToken(TokenTypeString)
-	case "void":
-		tok = lexer.ConstructToken(TokenTypeVoid)
-	case "nullptr":
-		tok = lexer.ConstructToken(TokenTypeNullptr)
-
-	case "package":
-		tok = lexer.ConstructToken(TokenTypePackage)
-	case "fn":
-		tok = lexer.ConstructToken(TokenTypeFn)
-	case "if":
-		tok = lexer.ConstructToken(TokenTypeIf)
-	case "for":
-		tok = lexer.ConstructToken(TokenTypeFor)
-	case "return":
-		tok = lexer.ConstructToken(TokenTypeReturn)
-	case "import":
-		tok = lexer.ConstructToken(TokenTypeImport)
-	case "pub":
-		tok = lexer.ConstructToken(TokenTypePub)
-	case "mut":
-		tok = lexer.ConstructToken(TokenTypeMut)
-	case "const":
-		tok = lexer.ConstructToken(TokenTypeConst)
-	case "type":
-		tok = lexer.ConstructToken(TokenTypeType)
-	case "while":
-		tok = lexer.ConstructToken(TokenTypeWhile)
-	case "class":
-		tok = lexer.ConstructToken(TokenTypeClass)
-	case "constructor":
-		tok = lexer.ConstructToken(TokenTypeConstructor)
-	case "new":
-		tok = lexer.ConstructToken(TokenTypeNew)
-	case "interface":
-		tok = lexer.ConstructToken(TokenTypeInterface)
-	case "struct":
-		tok = lexer.ConstructToken(TokenTypeStruct)
-
-	case "==":
-		tok = lexer.ConstructToken(TokenTypeCompareEq)
-	case "!=":
-		tok = lexer.ConstructToken(TokenTypeCompareNe)
-	case "<":
-		tok = lexer.ConstructToken(TokenTypeCompareLt)
-	case ">":
-		tok = lexer.ConstructToken(TokenTypeCompareGt)
-	case "<=":
-		tok = lexer.ConstructToken(TokenTypeCompareLtEq)
-	case ">=":
-		tok = lexer.ConstructToken(TokenTypeCompareGtEq)
-	case "&&":
-		tok = lexer.ConstructToken(TokenTypeAnd)
-	case "||":
-		tok = lexer.ConstructToken(TokenTypeOr)
-
-	case ":":
-		tok = lexer.ConstructToken(TokenTypeColon)
-	case ";":
-		tok = lexer.ConstructToken(TokenTypeSemicolon)
-	case ",":
-		tok = lexer.ConstructToken(TokenTypeComma)
-	case ".":
-		tok = lexer.ConstructToken(TokenTypePeriod)
-	case "(":
-		tok = lexer.ConstructToken(TokenTypeOpenParen)
-	case ")":
-		tok = lexer.ConstructToken(TokenTypeCloseParen)
-	case "{":
-		tok = lexer.ConstructToken(TokenTypeOpenCurlyBracket)
-	case "}":
-		tok = lexer.ConstructToken(TokenTypeCloseCurlyBracket)
-	case "[":
-		tok = lexer.ConstructToken(TokenTypeOpenSquareBracket)
-	case "]":
-		tok = lexer.ConstructToken(TokenTypeCloseSquareBracket)
-
-	case "=":
-		tok = lexer.ConstructToken(TokenTypeEq)
-	case "*":
-		tok = lexer.ConstructToken(TokenTypeAsterisk)
-	case "/":
-		tok = lexer.ConstructToken(TokenTypeSlash)
-	case "+":
-		tok = lexer.ConstructToken(TokenTypePlus)
-	case "-":
-		tok = lexer.ConstructToken(TokenTypeMinus)
-	case "->":
-		tok = lexer.ConstructToken(TokenTypeArrow)
-	case "&":
-		tok = lexer.ConstructToken(TokenTypeAmpersand)
-
-	case "true":
-		tok = lexer.ConstructToken(TokenTypeTrue)
-	case "false":
-		tok = lexer.ConstructToken(TokenTypeFalse)
-
-	default:
-		if lexer.State == LexerStateString {
-			tok = lexer.ConstructToken(TokenTypeStringLiteral)
-		} else if utils.IsNumber(lexer.Token) {
-			tok = lexer.ConstructToken(TokenTypeNumberLiteral)
+// Offset of the quote that ends the string literal i is in, or len(Src) if there isn't one
+func (lexer *Lexer) SkipString(i int) int {
+	// Jump to the closing quote, only stopping at the escapes before it
+	start := i
+	end := lexer.IndexFrom(i, '"')
+	for {
+		escape := bytes.IndexByte(lexer.Src[i:end], '\\')
+		if escape == -1 {
+			break
+		}
+		i += escape + 2 // The escaped char can't end the string
+		if i > len(lexer.Src) {
+			i = len(lexer.Src)
+		}
+		if i > end {
+			end = lexer.IndexFrom(i, '"')
+		}
+	}
+	lexer.SkipLines(start, end)
+	return end
+}
+
+/*
+ * Get the next token and move past it
+ * Tokens are read from Src as they're asked for, only the ones that have been peeked at are kept
+ * An identifier is interned the first time it's peeked at, after that its Symbol comes from Syms
+ */
+func (lexer *Lexer) NextToken() Token {
+	tok := lexer.PeekToken(0)
+	if tok.TokenType == TokenTypeEOF {
+		return tok
+	}
+
+	lexer.Head++
+	if lexer.Head == len(lexer.Spans) {
+		lexer.Spans = lexer.Spans[:0]
+		lexer.Syms = lexer.Syms[:0]
+		lexer.Head = 0
+	} else if lexer.Head >= maxLookahead {
+		// Slide the unread spans back to the front so the buffer doesn't grow
+		lexer.Spans = lexer.Spans[:copy(lexer.Spans, lexer.Spans[lexer.Head:])]
+		if len(lexer.Syms) > lexer.Head {
+			lexer.Syms = lexer.Syms[:copy(lexer.Syms, lexer.Syms[lexer.Head:])]
 		} else {
-			tok = lexer.ConstructToken(TokenTypeIdentifier)
+			lexer.Syms = lexer.Syms[:0]
 		}
+		lexer.Head = 0
+	}
+	return tok
+}
+
+// Get the k'th token after the current one without moving past anything (PeekToken(0) is what NextToken returns)
+func (lexer *Lexer) PeekToken(k int) Token {
+	for lexer.Head+k >= len(lexer.Spans) && lexer.Scan() {
 	}
 
-	// tok &&
-	if len(lexer.Token) > 0 {
-		lexer.Tokens = append(lexer.Tokens, tok)
-		lexer.Token = ""
+	i := lexer.Head + k
+	if i >= len(lexer.Spans) {
+		// Everything after the end is EOF
+		i = len(lexer.Spans) - 1
 	}
-	if c != '\x00' {
-		lexer.Token = string(c)
-		lexer.AddTokenIfValid('\x00')
-		lexer.Pos.Col++
+	span := lexer.Spans[i]
+	if span.TokenType() != TokenTypeIdentifier {
+		return lexer.Token(span)
+	}
+
+	for len(lexer.Syms) <= i {
+		lexer.Syms = append(lexer.Syms, 0)
 	}
+	sym := lexer.Syms[i]
+	if sym == 0 {
+		sym = lexer.intern(span)
+		lexer.Syms[i] = sym
+	}
+	return lexer.identToken(span, sym)
 }
 
-func (lexer *Lexer) ConstructToken(tokenType TokenType) Token {
-	var tok Token
-	tok.TokenType = tokenType
-	tok.Value = lexer.Token
-	tok.Pos.Col = lexer.Pos.Col
-	tokLen := len(lexer.Token)
-	// This is just some weird stuff with the position of single char tokens
-	// You just can't subtract the length if it's a single char token since we did some
-	// Magic/messy stuff with them
-	if tokLen > 0 && !utils.ContainsByte(singleCharTokens[:], byte(lexer.Token[0])) {
-		tok.Pos.Col -= tokLen
-	}
-	tok.Pos.Row = lexer.Pos.Row
-	return tok
+// Make Tokens from Spans for consumers that need owned token values
+func (lexer *Lexer) FillTokens() {
+	lexer.Tokens = make([]Token, len(lexer.Spans))
+	for i, span := range lexer.Spans {
+		lexer.Tokens[i] = lexer.Token(span)
+	}
+}
+
+// Unpack a span, interning it if it's an identifier
+func (lexer *Lexer) Token(span Span) Token {
+	if span.TokenType() == TokenTypeIdentifier {
+		return lexer.identToken(span, lexer.intern(span))
+	}
+	return Token{TokenType: span.TokenType(), Value: lexer.Value(span), Pos: lexer.SpanPos(span)}
+}
+
+func (lexer *Lexer) intern(span Span) Symbol {
+	sym := lexer.Symbols.Intern(lexer.Src[span.Start:span.End()])
+	lexer.addIdent(sym)
+	return sym
+}
+
+func (lexer *Lexer) identToken(span Span, sym Symbol) Token {
+	return Token{TokenType: TokenTypeIdentifier, Value: lexer.Symbols.Name(sym), Pos: lexer.SpanPos(span), Sym: sym}
+}
+
+func (lexer *Lexer) addIdent(sym Symbol) {
+	for int(sym) >= len(lexer.identSeen) {
+		lexer.identSeen = append(lexer.identSeen, false)
+	}
+	if !lexer.identSeen[sym] {
+		lexer.identSeen[sym] = true
+		lexer.Idents = append(lexer.Idents, sym)
+	}
+}
+
+func (lexer *Lexer) SpanPos(span Span) TokenPos {
+	if span.TokenType() == TokenTypeEOF {
+		return TokenPos{-1, -1}
+	}
+	return lexer.PosOf(int(span.Start))
+}
+
+/*
+ * Row and column of an offset that has already been read
+ * Offsets on the last line read are the common case, anything before it is a binary search of Lines
+ */
+func (lexer *Lexer) PosOf(offset int) TokenPos {
+	lines := lexer.Lines
+	row := len(lines)
+	if offset < int(lines[row-1]) {
+		row = sort.Search(len(lines), func(r int) bool { return int(lines[r]) > offset })
+	}
+	return TokenPos{Row: row, Col: offset - int(lines[row-1]) + 1}
+}
+
+/*
+ * The text of a span
+ * Keywords and operators share one string per TokenType, so only literals and identifiers get allocated
+ */
+func (lexer *Lexer) Value(span Span) string {
+	if text := tokenTexts[span.Kind]; text != "" {
+		return text
+	}
+	return string(lexer.Src[span.Start:span.End()])
+}
+
+// Offset of the first c at or after i, or len(Src) if there isn't one
+func (lexer *Lexer) IndexFrom(i int, c byte) int {
+	if i >= len(lexer.Src) {
+		return len(lexer.Src)
+	}
+	if n := bytes.IndexByte(lexer.Src[i:], c); n != -1 {
+		return i + n
+	}
+	return len(lexer.Src)
+}
+
+// Record every newline between start and end
+func (lexer *Lexer) SkipLines(start, end int) {
+	for i := lexer.IndexFrom(start, '\n'); i < end; i = lexer.IndexFrom(i+1, '\n') {
+		lexer.NewLine(i)
+	}
+}
+
+func (lexer *Lexer) NewLine(i int) {
+	lexer.Lines = append(lexer.Lines, uint32(i+1))
+}
+
+func (lexer *Lexer) AddSpan(tokenType TokenType, start, end int) {
+	lexer.Spans = append(lexer.Spans, Span{Start: uint32(start), Len: uint32(end - start), Kind: uint8(tokenType)})
 }
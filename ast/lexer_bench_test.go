@@ -0,0 +1,189 @@
+package ast_test
+
+import (
+	"bytes"
+	"fmt"
+	"math/rand"
+	"strings"
+	"testing"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+)
+
+// Shapes of generated source, each one stresses a different part of the lexer
+var corpusShapes = []struct {
+	Name string
+	Line func(r *rand.Rand, buf *bytes.Buffer)
+}{
+	{"identifiers", identifierLine},
+	{"comments", commentLine},
+	{"strings", stringLine},
+	{"numbers", numberLine},
+}
+
+var corpusSizes = []int{1 << 20, 10 << 20, 100 << 20}
+
+var corpora = map[string][]byte{}
+
+/*
+ * Get a generated corpus of (at least) size bytes
+ * The same shape and size always gives the same source, it's only generated once per run
+ */
+func corpus(shape int, size int) []byte {
+	key := fmt.Sprintf("%s/%d", corpusShapes[shape].Name, size)
+	if src, ok := corpora[key]; ok {
+		return src
+	}
+
+	r := rand.New(rand.NewSource(int64(shape)))
+	var buf bytes.Buffer
+	buf.Grow(size + 256)
+	for buf.Len() < size {
+		corpusShapes[shape].Line(r, &buf)
+	}
+	corpora[key] = buf.Bytes()
+	return buf.Bytes()
+}
+
+const identChars = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789"
+
+var benchKeywords = []string{"mut", "const", "i32", "f64", "string", "return", "fn", "type", "struct", "pub"}
+
+func writeIdent(r *rand.Rand, buf *bytes.Buffer) {
+	n := 1 + r.Intn(12)
+	buf.WriteByte(identChars[r.Intn(52)])
+	for i := 1; i < n; i++ {
+		buf.WriteByte(identChars[r.Intn(len(identChars))])
+	}
+}
+
+func writeWords(r *rand.Rand, buf *bytes.Buffer, n int) {
+	for i := 0; i < n; i++ {
+		if i > 0 {
+			buf.WriteByte(' ')
+		}
+		writeIdent(r, buf)
+	}
+}
+
+func identifierLine(r *rand.Rand, buf *bytes.Buffer) {
+	buf.WriteByte('\t')
+	for i := 0; i < 8; i++ {
+		if r.Intn(4) == 0 {
+			buf.WriteString(benchKeywords[r.Intn(len(benchKeywords))])
+		} else {
+			writeIdent(r, buf)
+		}
+		buf.WriteString([]string{" ", ", ", "(", ")", ".", " = "}[r.Intn(6)])
+	}
+	buf.WriteByte('\n')
+}
+
+func commentLine(r *rand.Rand, buf *bytes.Buffer) {
+	switch r.Intn(3) {
+	case 0:
+		buf.WriteString("// ")
+		writeWords(r, buf, 4+r.Intn(12))
+		buf.WriteByte('\n')
+	case 1:
+		buf.WriteString("/*\n")
+		for i := r.Intn(8); i >= 0; i-- {
+			buf.WriteString(" * ")
+			writeWords(r, buf, 4+r.Intn(12))
+			buf.WriteByte('\n')
+		}
+		buf.WriteString(" */\n")
+	case 2:
+		identifierLine(r, buf)
+	}
+}
+
+func stringLine(r *rand.Rand, buf *bytes.Buffer) {
+	buf.WriteString("\tconst string ")
+	writeIdent(r, buf)
+	buf.WriteString(" = \"")
+	for i := r.Intn(16); i >= 0; i-- {
+		writeIdent(r, buf)
+		buf.WriteString([]string{" ", " ", " ", "\\\"", "\\n", "\\\\"}[r.Intn(6)])
+	}
+	buf.WriteString("\"\n")
+}
+
+func numberLine(r *rand.Rand, buf *bytes.Buffer) {
+	buf.WriteString("\tconst f64 ")
+	writeIdent(r, buf)
+	buf.WriteString(" = ")
+	for i := r.Intn(8); i >= 0; i-- {
+		switch r.Intn(3) {
+		case 0:
+			fmt.Fprintf(buf, "%d", r.Int63n(1<<40))
+		case 1:
+			fmt.Fprintf(buf, "%.4f", r.Float64()*1e6)
+		case 2:
+			fmt.Fprintf(buf, "-%d", r.Intn(1000))
+		}
+		buf.WriteString([]string{" + ", " * ", " - ", " / "}[r.Intn(4)])
+	}
+	buf.WriteString("0\n")
+}
+
+// Run bench over every corpus, 100MB ones are skipped with -short
+func benchmarkCorpora(b *testing.B, bench func(b *testing.B, src []byte)) {
+	for shape := range corpusShapes {
+		for _, size := range corpusSizes {
+			if testing.Short() && size > 10<<20 {
+				continue
+			}
+			name := fmt.Sprintf("%s/%dMB", corpusShapes[shape].Name, size>>20)
+			b.Run(name, func(b *testing.B) {
+				src := corpus(shape, size)
+				b.SetBytes(int64(len(src)))
+				b.ReportAllocs()
+				b.ResetTimer()
+				bench(b, src)
+			})
+		}
+	}
+}
+
+func BenchmarkTokenize(b *testing.B) {
+	benchmarkCorpora(b, func(b *testing.B, src []byte) {
+		b.StopTimer()
+		lines := strings.SplitAfter(string(src), "\n")
+		b.StartTimer()
+		for i := 0; i < b.N; i++ {
+			var lexer ast.Lexer
+			lexer.Tokenize(lines)
+		}
+	})
+}
+
+func BenchmarkTokenizeBuffer(b *testing.B) {
+	benchmarkCorpora(b, func(b *testing.B, src []byte) {
+		var lexer ast.Lexer
+		for i := 0; i < b.N; i++ {
+			lexer.TokenizeBuffer(src)
+		}
+	})
+}
+
+func BenchmarkTokenizeParallel(b *testing.B) {
+	benchmarkCorpora(b, func(b *testing.B, src []byte) {
+		var lexer ast.Lexer
+		for i := 0; i < b.N; i++ {
+			lexer.TokenizeParallel(src)
+		}
+	})
+}
+
+// Pulling every token the way the parser does
+func BenchmarkNextToken(b *testing.B) {
+	benchmarkCorpora(b, func(b *testing.B, src []byte) {
+		var lexer ast.Lexer
+		for i := 0; i < b.N; i++ {
+			lexer.Reset(src)
+			for lexer.NextToken().TokenType != ast.TokenTypeEOF {
+			}
+		}
+	})
+}
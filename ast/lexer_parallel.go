@@ -0,0 +1,109 @@
+package ast
+
+import (
+	"bytes"
+	"runtime"
+	"sync"
+)
+
+// Buffers smaller than this aren't worth splitting up
+const minParallelChunkSize = 256 << 10
+
+// The part of a source buffer one goroutine lexes
+type lexerChunk struct {
+	Lexer      Lexer
+	Start      int
+	StartState LexerState // The state Lexer was started in
+	TokStart   int        // Start of the string literal Lexer was started inside of, if StartState is LexerStateString
+}
+
+/*
+ * Tokenize src on several goroutines and fill Spans, the result is the same as TokenizeBuffer's
+ *
+ * src is split into chunks after newlines and every chunk is lexed on its own goroutine, assuming it starts in LexerStateNormal
+ * A chunk can really start inside a string or block comment though, and it's only known which once the chunk before it is done
+ * So the chunks are then walked in order and any chunk whose assumed start state was wrong gets lexed again
+ */
+func (lexer *Lexer) TokenizeParallel(src []byte) {
+	chunks := splitChunks(src, runtime.GOMAXPROCS(0))
+	if len(chunks) < 2 {
+		lexer.TokenizeBuffer(src)
+		return
+	}
+
+	var wg sync.WaitGroup
+	for i := range chunks {
+		wg.Add(1)
+		go func(chunk *lexerChunk) {
+			defer wg.Done()
+			chunk.Lex(LexerStateNormal, -1)
+		}(&chunks[i])
+	}
+	wg.Wait()
+
+	lexer.Reset(src)
+	state, tokStart := LexerStateNormal, -1
+	for i := range chunks {
+		chunk := &chunks[i]
+		// Only a string literal's start carries over a newline, anywhere else TokStart is left over from a finished token
+		if chunk.StartState != state || (state == LexerStateString && chunk.TokStart != tokStart) {
+			chunk.Lex(state, tokStart)
+		}
+		lexer.Spans = append(lexer.Spans, chunk.Lexer.Spans...)
+		lexer.Lines = append(lexer.Lines, chunk.Lexer.Lines...)
+		state, tokStart = chunk.Lexer.State, chunk.Lexer.TokStart
+	}
+
+	// Only the last chunk can end in the middle of a token, finish it like Scan does
+	lexer.State, lexer.TokStart = state, tokStart
+	lexer.Offset = len(src)
+	for lexer.Scan() {
+	}
+}
+
+/*
+ * Split src into at most n chunks that each end just after a newline (apart from the last one)
+ * Only the end of each chunk's Lexer.Src is set, it's src up to the end of the chunk
+ */
+func splitChunks(src []byte, n int) []lexerChunk {
+	if n > len(src)/minParallelChunkSize {
+		n = len(src) / minParallelChunkSize
+	}
+	if n < 2 {
+		return nil
+	}
+
+	chunks := make([]lexerChunk, 0, n)
+	start := 0
+	for i := 1; i <= n && start < len(src); i++ {
+		end := len(src)
+		if i < n {
+			end = len(src) / n * i
+			if end < start {
+				end = start
+			}
+			if nl := bytes.IndexByte(src[end:], '\n'); nl != -1 {
+				end += nl + 1
+			} else {
+				end = len(src)
+			}
+		}
+		chunks = append(chunks, lexerChunk{Start: start, Lexer: Lexer{Src: src[:end]}})
+		start = end
+	}
+	return chunks
+}
+
+// Lex the chunk from its start in state, inside of a string literal starting at tokStart if state is LexerStateString
+func (chunk *lexerChunk) Lex(state LexerState, tokStart int) {
+	chunk.StartState = state
+	chunk.TokStart = tokStart
+
+	lexer := &chunk.Lexer
+	lexer.Spans = lexer.Spans[:0]
+	lexer.Lines = lexer.Lines[:0]
+	lexer.Offset = chunk.Start
+	lexer.State = state
+	lexer.TokStart = tokStart
+	lexer.ScanUntil(int(^uint(0) >> 1))
+}
@@ -0,0 +1,1021 @@
+// Code generated by internal/dfagen from tokens.spec; DO NOT EDIT.
+
+package ast
+
+// Every token that is recognized by its exact text
+var keywords = [...]struct {
+	Text      string
+	TokenType TokenType
+}{
+	{"i64", TokenTypeI64},
+	{"u64", TokenTypeU64},
+	{"i32", TokenTypeI32},
+	{"u32", TokenTypeU32},
+	{"i16", TokenTypeI16},
+	{"u16", TokenTypeU16},
+	{"i8", TokenTypeI8},
+	{"u8", TokenTypeU8},
+	{"f64", TokenTypeF64},
+	{"f32", TokenTypeF32},
+	{"bool", TokenTypeBool},
+	{"string", TokenTypeString},
+	{"void", TokenTypeVoid},
+	{"nullptr", TokenTypeNullptr},
+	{"package", TokenTypePackage},
+	{"fn", TokenTypeFn},
+	{"if", TokenTypeIf},
+	{"for", TokenTypeFor},
+	{"return", TokenTypeReturn},
+	{"import", TokenTypeImport},
+	{"pub", TokenTypePub},
+	{"mut", TokenTypeMut},
+	{"const", TokenTypeConst},
+	{"type", TokenTypeType},
+	{"while", TokenTypeWhile},
+	{"class", TokenTypeClass},
+	{"constructor", TokenTypeConstructor},
+	{"new", TokenTypeNew},
+	{"interface", TokenTypeInterface},
+	{"struct", TokenTypeStruct},
+	{"==", TokenTypeCompareEq},
+	{"!=", TokenTypeCompareNe},
+	{"<", TokenTypeCompareLt},
+	{">", TokenTypeCompareGt},
+	{"<=", TokenTypeCompareLtEq},
+	{">=", TokenTypeCompareGtEq},
+	{"&&", TokenTypeAnd},
+	{"||", TokenTypeOr},
+	{":", TokenTypeColon},
+	{";", TokenTypeSemicolon},
+	{",", TokenTypeComma},
+	{".", TokenTypePeriod},
+	{"(", TokenTypeOpenParen},
+	{")", TokenTypeCloseParen},
+	{"{", TokenTypeOpenCurlyBracket},
+	{"}", TokenTypeCloseCurlyBracket},
+	{"[", TokenTypeOpenSquareBracket},
+	{"]", TokenTypeCloseSquareBracket},
+	{"=", TokenTypeEq},
+	{"*", TokenTypeAsterisk},
+	{"/", TokenTypeSlash},
+	{"+", TokenTypePlus},
+	{"-", TokenTypeMinus},
+	{"->", TokenTypeArrow},
+	{"&", TokenTypeAmpersand},
+	{"true", TokenTypeTrue},
+	{"false", TokenTypeFalse},
+}
+
+const (
+	dfaEmit      = 1
+	dfaSplit     = 2
+	dfaStartHere = 4
+	dfaStartNext = 8
+	dfaNewLine   = 16
+	dfaSkip      = 32
+
+	dfaStateCount = 151
+	dfaClassCount = 55 // Including the end of input
+	dfaClassEOF   = 54
+
+	// States that read the rest of a word, every word byte keeps them where they are without doing anything
+	dfaIdentifier = 12
+	dfaNumber     = 11
+)
+
+// The class of every byte
+var dfaClasses = [256]uint8{
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 1, 1, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1, 3, 4, 0, 0, 0, 5, 0, 6, 7, 8, 9, 10, 11, 12, 13,
+	14, 15, 16, 17, 18, 14, 19, 14, 20, 14, 21, 22, 23, 24, 25, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 27, 28, 0, 0,
+	0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 0, 38, 39, 40, 41, 42,
+	43, 0, 44, 45, 46, 47, 48, 49, 0, 50, 0, 51, 52, 53, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+}
+
+// The TokenType of the token being read in every state
+var dfaAccept = [dfaStateCount]uint8{
+	uint8(TokenTypeEOF),                // Normal
+	uint8(TokenTypeStringLiteral),      // String
+	uint8(TokenTypeEOF),                // LineComment
+	uint8(TokenTypeEOF),                // BlockComment
+	uint8(TokenTypeStringLiteral),      // StringEscape
+	uint8(TokenTypeEOF),                // BlockCommentStar
+	uint8(TokenTypeSlash),              // Slash
+	uint8(TokenTypeMinus),              // Minus
+	uint8(TokenTypeMinus),              // MinusAfterWord
+	uint8(TokenTypePeriod),             // Dot
+	uint8(TokenTypeNumberLiteral),      // NumberDot
+	uint8(TokenTypeNumberLiteral),      // Number
+	uint8(TokenTypeIdentifier),         // Identifier
+	uint8(TokenTypeOpenParen),          // OpenParen
+	uint8(TokenTypeCloseParen),         // CloseParen
+	uint8(TokenTypeAsterisk),           // Asterisk
+	uint8(TokenTypePlus),               // Plus
+	uint8(TokenTypeComma),              // Comma
+	uint8(TokenTypePeriod),             // Period
+	uint8(TokenTypeSemicolon),          // Semicolon
+	uint8(TokenTypeIdentifier),         // '!'
+	uint8(TokenTypeCompareNe),          // '!='
+	uint8(TokenTypeAmpersand),          // '&'
+	uint8(TokenTypeAnd),                // '&&'
+	uint8(TokenTypeArrow),              // '->'
+	uint8(TokenTypeColon),              // ':'
+	uint8(TokenTypeCompareLt),          // '<'
+	uint8(TokenTypeCompareLtEq),        // '<='
+	uint8(TokenTypeEq),                 // '='
+	uint8(TokenTypeCompareEq),          // '=='
+	uint8(TokenTypeCompareGt),          // '>'
+	uint8(TokenTypeCompareGtEq),        // '>='
+	uint8(TokenTypeOpenSquareBracket),  // '['
+	uint8(TokenTypeCloseSquareBracket), // ']'
+	uint8(TokenTypeIdentifier),         // 'b'
+	uint8(TokenTypeIdentifier),         // 'bo'
+	uint8(TokenTypeIdentifier),         // 'boo'
+	uint8(TokenTypeBool),               // 'bool'
+	uint8(TokenTypeIdentifier),         // 'c'
+	uint8(TokenTypeIdentifier),         // 'cl'
+	uint8(TokenTypeIdentifier),         // 'cla'
+	uint8(TokenTypeIdentifier),         // 'clas'
+	uint8(TokenTypeClass),              // 'class'
+	uint8(TokenTypeIdentifier),         // 'co'
+	uint8(TokenTypeIdentifier),         // 'con'
+	uint8(TokenTypeIdentifier),         // 'cons'
+	uint8(TokenTypeConst),              // 'const'
+	uint8(TokenTypeIdentifier),         // 'constr'
+	uint8(TokenTypeIdentifier),         // 'constru'
+	uint8(TokenTypeIdentifier),         // 'construc'
+	uint8(TokenTypeIdentifier),         // 'construct'
+	uint8(TokenTypeIdentifier),         // 'constructo'
+	uint8(TokenTypeConstructor),        // 'constructor'
+	uint8(TokenTypeIdentifier),         // 'f'
+	uint8(TokenTypeIdentifier),         // 'f3'
+	uint8(TokenTypeF32),                // 'f32'
+	uint8(TokenTypeIdentifier),         // 'f6'
+	uint8(TokenTypeF64),                // 'f64'
+	uint8(TokenTypeIdentifier),         // 'fa'
+	uint8(TokenTypeIdentifier),         // 'fal'
+	uint8(TokenTypeIdentifier),         // 'fals'
+	uint8(TokenTypeFalse),              // 'false'
+	uint8(TokenTypeFn),                 // 'fn'
+	uint8(TokenTypeIdentifier),         // 'fo'
+	uint8(TokenTypeFor),                // 'for'
+	uint8(TokenTypeIdentifier),         // 'i'
+	uint8(TokenTypeIdentifier),         // 'i1'
+	uint8(TokenTypeI16),                // 'i16'
+	uint8(TokenTypeIdentifier),         // 'i3'
+	uint8(TokenTypeI32),                // 'i32'
+	uint8(TokenTypeIdentifier),         // 'i6'
+	uint8(TokenTypeI64),                // 'i64'
+	uint8(TokenTypeI8),                 // 'i8'
+	uint8(TokenTypeIf),                 // 'if'
+	uint8(TokenTypeIdentifier),         // 'im'
+	uint8(TokenTypeIdentifier),         // 'imp'
+	uint8(TokenTypeIdentifier),         // 'impo'
+	uint8(TokenTypeIdentifier),         // 'impor'
+	uint8(TokenTypeImport),             // 'import'
+	uint8(TokenTypeIdentifier),         // 'in'
+	uint8(TokenTypeIdentifier),         // 'int'
+	uint8(TokenTypeIdentifier),         // 'inte'
+	uint8(TokenTypeIdentifier),         // 'inter'
+	uint8(TokenTypeIdentifier),         // 'interf'
+	uint8(TokenTypeIdentifier),         // 'interfa'
+	uint8(TokenTypeIdentifier),         // 'interfac'
+	uint8(TokenTypeInterface),          // 'interface'
+	uint8(TokenTypeIdentifier),         // 'm'
+	uint8(TokenTypeIdentifier),         // 'mu'
+	uint8(TokenTypeMut),                // 'mut'
+	uint8(TokenTypeIdentifier),         // 'n'
+	uint8(TokenTypeIdentifier),         // 'ne'
+	uint8(TokenTypeNew),                // 'new'
+	uint8(TokenTypeIdentifier),         // 'nu'
+	uint8(TokenTypeIdentifier),         // 'nul'
+	uint8(TokenTypeIdentifier),         // 'null'
+	uint8(TokenTypeIdentifier),         // 'nullp'
+	uint8(TokenTypeIdentifier),         // 'nullpt'
+	uint8(TokenTypeNullptr),            // 'nullptr'
+	uint8(TokenTypeIdentifier),         // 'p'
+	uint8(TokenTypeIdentifier),         // 'pa'
+	uint8(TokenTypeIdentifier),         // 'pac'
+	uint8(TokenTypeIdentifier),         // 'pack'
+	uint8(TokenTypeIdentifier),         // 'packa'
+	uint8(TokenTypeIdentifier),         // 'packag'
+	uint8(TokenTypePackage),            // 'package'
+	uint8(TokenTypeIdentifier),         // 'pu'
+	uint8(TokenTypePub),                // 'pub'
+	uint8(TokenTypeIdentifier),         // 'r'
+	uint8(TokenTypeIdentifier),         // 're'
+	uint8(TokenTypeIdentifier),         // 'ret'
+	uint8(TokenTypeIdentifier),         // 'retu'
+	uint8(TokenTypeIdentifier),         // 'retur'
+	uint8(TokenTypeReturn),             // 'return'
+	uint8(TokenTypeIdentifier),         // 's'
+	uint8(TokenTypeIdentifier),         // 'st'
+	uint8(TokenTypeIdentifier),         // 'str'
+	uint8(TokenTypeIdentifier),         // 'stri'
+	uint8(TokenTypeIdentifier),         // 'strin'
+	uint8(TokenTypeString),             // 'string'
+	uint8(TokenTypeIdentifier),         // 'stru'
+	uint8(TokenTypeIdentifier),         // 'struc'
+	uint8(TokenTypeStruct),             // 'struct'
+	uint8(TokenTypeIdentifier),         // 't'
+	uint8(TokenTypeIdentifier),         // 'tr'
+	uint8(TokenTypeIdentifier),         // 'tru'
+	uint8(TokenTypeTrue),               // 'true'
+	uint8(TokenTypeIdentifier),         // 'ty'
+	uint8(TokenTypeIdentifier),         // 'typ'
+	uint8(TokenTypeType),               // 'type'
+	uint8(TokenTypeIdentifier),         // 'u'
+	uint8(TokenTypeIdentifier),         // 'u1'
+	uint8(TokenTypeU16),                // 'u16'
+	uint8(TokenTypeIdentifier),         // 'u3'
+	uint8(TokenTypeU32),                // 'u32'
+	uint8(TokenTypeIdentifier),         // 'u6'
+	uint8(TokenTypeU64),                // 'u64'
+	uint8(TokenTypeU8),                 // 'u8'
+	uint8(TokenTypeIdentifier),         // 'v'
+	uint8(TokenTypeIdentifier),         // 'vo'
+	uint8(TokenTypeIdentifier),         // 'voi'
+	uint8(TokenTypeVoid),               // 'void'
+	uint8(TokenTypeIdentifier),         // 'w'
+	uint8(TokenTypeIdentifier),         // 'wh'
+	uint8(TokenTypeIdentifier),         // 'whi'
+	uint8(TokenTypeIdentifier),         // 'whil'
+	uint8(TokenTypeWhile),              // 'while'
+	uint8(TokenTypeOpenCurlyBracket),   // '{'
+	uint8(TokenTypeIdentifier),         // '|'
+	uint8(TokenTypeOr),                 // '||'
+	uint8(TokenTypeCloseCurlyBracket),  // '}'
+}
+
+/*
+ * Row of dfaClassCount transitions for every state
+ * The low byte of a transition is its next state and the high byte is its dfa* flags
+ */
+var dfaTransitions = [dfaStateCount * dfaClassCount]uint16{
+	// Normal
+	0x040c, 0x0000, 0x1000, 0x0414, 0x2801, 0x0416, 0x040d, 0x040e, 0x040f, 0x0410, 0x0411, 0x0407, 0x0409, 0x0406, 0x040b, 0x040b,
+	0x040b, 0x040b, 0x040b, 0x040b, 0x040b, 0x0419, 0x0413, 0x041a, 0x041c, 0x041e, 0x0420, 0x040c, 0x0421, 0x040c, 0x0422, 0x0426,
+	0x040c, 0x040c, 0x0435, 0x040c, 0x040c, 0x0441, 0x040c, 0x040c, 0x0457, 0x045a, 0x040c, 0x0463, 0x046c, 0x0472, 0x047b, 0x0482,
+	0x048a, 0x048e, 0x040c, 0x0493, 0x0494, 0x0496, 0x0000,
+	// String
+	0x2001, 0x2001, 0x1001, 0x2001, 0x0100, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001,
+	0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x0004, 0x2001, 0x2001, 0x2001, 0x2001,
+	0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001,
+	0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x0100,
+	// LineComment
+	0x2002, 0x2002, 0x1000, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+	0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+	0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002,
+	0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x2002, 0x0002,
+	// BlockComment
+	0x2003, 0x2003, 0x1003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x0005, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003,
+	0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003,
+	0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003,
+	0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x0003,
+	// StringEscape
+	0x2001, 0x2001, 0x1001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001,
+	0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001,
+	0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001,
+	0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x2001, 0x0100,
+	// BlockCommentStar
+	0x2003, 0x2003, 0x1003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x0005, 0x2003, 0x2003, 0x2003, 0x2003, 0x0000, 0x2003, 0x2003,
+	0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003,
+	0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003,
+	0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x2003, 0x0003,
+	// Slash
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x2003, 0x0510, 0x0511, 0x0507, 0x0509, 0x2002, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Minus
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x000b, 0x000b,
+	0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0519, 0x0513, 0x051a, 0x051c, 0x0018, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// MinusAfterWord
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x0018, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Dot
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x000b, 0x000b,
+	0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// NumberDot
+	0x060c, 0x0200, 0x1200, 0x0614, 0x2a01, 0x0616, 0x060d, 0x060e, 0x060f, 0x0610, 0x0611, 0x0607, 0x0609, 0x0606, 0x000b, 0x000b,
+	0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0619, 0x0613, 0x061a, 0x061c, 0x061e, 0x0620, 0x060c, 0x0621, 0x060c, 0x0622, 0x0626,
+	0x060c, 0x060c, 0x0635, 0x060c, 0x060c, 0x0641, 0x060c, 0x060c, 0x0657, 0x065a, 0x060c, 0x0663, 0x066c, 0x0672, 0x067b, 0x0682,
+	0x068a, 0x068e, 0x060c, 0x0693, 0x0694, 0x0696, 0x0200,
+	// Number
+	0x000b, 0x0100, 0x1100, 0x000b, 0x2901, 0x000b, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x000a, 0x0506, 0x000b, 0x000b,
+	0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0513, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+	0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
+	0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x0100,
+	// Identifier
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// OpenParen
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// CloseParen
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Asterisk
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Plus
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Comma
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Period
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// Semicolon
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// '!'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x0015, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '!='
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '&'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x0017, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '&&'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '->'
+	0x050c, 0x0100, 0x1100, 0x0514, 0x2901, 0x0516, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0507, 0x0509, 0x0506, 0x050b, 0x050b,
+	0x050b, 0x050b, 0x050b, 0x050b, 0x050b, 0x0519, 0x0513, 0x051a, 0x051c, 0x051e, 0x0520, 0x050c, 0x0521, 0x050c, 0x0522, 0x0526,
+	0x050c, 0x050c, 0x0535, 0x050c, 0x050c, 0x0541, 0x050c, 0x050c, 0x0557, 0x055a, 0x050c, 0x0563, 0x056c, 0x0572, 0x057b, 0x0582,
+	0x058a, 0x058e, 0x050c, 0x0593, 0x0594, 0x0596, 0x0100,
+	// ':'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '<'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x001b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '<='
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '='
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x001d, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '=='
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '>'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x001f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '>='
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '['
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// ']'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'b'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0023, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'bo'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0024, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'boo'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0025, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'bool'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'c'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0027, 0x000c, 0x000c, 0x002b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'cl'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0028, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'cla'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0029, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'clas'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x002a, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'class'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'co'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x002c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'con'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x002d, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'cons'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x002e, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'const'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x002f, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'constr'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0030,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'constru'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0031,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'construc'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0032, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'construct'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0033, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'constructo'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0034, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'constructor'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'f'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x0036, 0x000c, 0x0038, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x003a, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x003e, 0x003f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'f3'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x0037, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'f32'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'f6'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x0039, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'f64'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'fa'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x003b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'fal'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x003c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'fals'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x003d, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'false'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'fn'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'fo'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0040, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'for'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x0042,
+	0x000c, 0x0044, 0x000c, 0x0046, 0x0048, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x0049, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x004a, 0x004f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i1'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x0043, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i16'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i3'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x0045, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i32'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i6'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x0047, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i64'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'i8'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'if'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'im'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x004b, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'imp'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x004c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'impo'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x004d, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'impor'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x004e, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'import'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'in'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0050, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'int'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x0051, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'inte'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0052, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'inter'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x0053, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'interf'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0054, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'interfa'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0055,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'interfac'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x0056, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'interface'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'm'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0058,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'mu'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0059, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'mut'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'n'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x005b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x005d,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'ne'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x005c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'new'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'nu'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x005e, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'nul'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x005f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'null'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0060, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'nullp'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0061, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'nullpt'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0062, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'nullptr'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'p'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0064, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x006a,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'pa'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0065,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'pac'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0066, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'pack'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0067, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'packa'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x0068, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'packag'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x0069, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'package'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'pu'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x006b, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'pub'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'r'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x006d, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 're'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x006e, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'ret'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x006f,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'retu'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0070, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'retur'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0071, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'return'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 's'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0073, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'st'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0074, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'str'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0075, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0078,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'stri'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0076, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'strin'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x0077, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'string'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'stru'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0079,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'struc'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x007a, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'struct'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 't'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x007c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x007f, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'tr'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x007d,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'tru'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x007e, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'true'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'ty'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0080, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'typ'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x0081, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'type'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x0083,
+	0x000c, 0x0085, 0x000c, 0x0087, 0x0089, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u1'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x0084, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u16'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u3'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x0086, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u32'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u6'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x0088, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u64'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'u8'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'v'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x008b, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'vo'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x008c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'voi'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x008d, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'void'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'w'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x008f, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'wh'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0090, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'whi'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0091, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'whil'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x0092, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// 'while'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '{'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '|'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x0095, 0x000c, 0x0100,
+	// '||'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+	// '}'
+	0x000c, 0x0100, 0x1100, 0x000c, 0x2901, 0x000c, 0x050d, 0x050e, 0x050f, 0x0510, 0x0511, 0x0508, 0x0512, 0x0506, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0513, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
+	0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x0100,
+}
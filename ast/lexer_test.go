@@ -1,7 +1,12 @@
 package ast_test
 
 import (
+	"bytes"
+	"reflect"
+	"runtime"
+	"strings"
 	"testing"
+	"unsafe"
 
 	"github.com/IbrahimFadel/pi-lang/ast"
 )
@@ -41,3 +46,127 @@ func CheckTokenTypes(t *testing.T, expected []ast.TokenType, got []ast.Token) {
 		}
 	}
 }
+
+func TestBufferSpans(t *testing.T) {
+	lexer.TokenizeBuffer([]byte("const string s = \"a \\\" b\" // comment\n\tx.5 -1\n"))
+	expected := []string{"const", "string", "s", "=", "a \\\" b", "x", ".", "5", "-1", "EOF"}
+	CheckExpectedNumberOfTokens(t, len(expected), len(lexer.Spans))
+	for i, span := range lexer.Spans {
+		if value := lexer.Value(span); value != expected[i] {
+			t.Errorf("Expected %d'th token to be '%s' but got '%s'", i, expected[i], value)
+		}
+	}
+	if pos := lexer.SpanPos(lexer.Spans[5]); pos != (ast.TokenPos{Row: 2, Col: 2}) {
+		t.Errorf("Expected 'x' at 2:2 but got %d:%d", pos.Row, pos.Col)
+	}
+}
+
+// Keywords are matched by the DFA, a word that only starts like one is an identifier
+func TestKeywords(t *testing.T) {
+	for word, expected := range map[string]ast.TokenType{"i8": ast.TokenTypeI8, "constructor": ast.TokenTypeConstructor, "type": ast.TokenTypeType, "true": ast.TokenTypeTrue, "->": ast.TokenTypeArrow, "}": ast.TokenTypeCloseCurlyBracket} {
+		lexer.TokenizeBuffer([]byte(word))
+		if got := lexer.Spans[0].TokenType(); len(lexer.Spans) != 2 || got != expected {
+			t.Errorf("Expected '%s' to have type %d but got type %d", word, expected, got)
+		}
+	}
+	for _, word := range []string{"i9", "types", "constructors", "tru", "x"} {
+		lexer.TokenizeBuffer([]byte(word))
+		if got := lexer.Spans[0].TokenType(); len(lexer.Spans) != 2 || got != ast.TokenTypeIdentifier {
+			t.Errorf("Expected '%s' to be an identifier but got type %d", word, got)
+		}
+	}
+}
+
+func TestStreamingMatchesTokenize(t *testing.T) {
+	src := "fn main()->{\n\treturn x+y*5.0/-1 - 9\n}"
+	lexer.Tokenize([]string{src})
+	expected := lexer.Tokens
+
+	var stream ast.Lexer
+	stream.Symbols = lexer.Symbols
+	stream.Reset([]byte(src))
+	if peeked := stream.PeekToken(2); peeked != expected[2] {
+		t.Errorf("Expected to peek %v but got %v", expected[2], peeked)
+	}
+	if peeked := stream.PeekToken(1); peeked != expected[1] || len(stream.Syms) < 2 || stream.Syms[1] != peeked.Sym {
+		t.Errorf("Expected to peek %v and keep its Symbol for NextToken", expected[1])
+	}
+	for i := 0; i < len(expected)+2; i++ {
+		want := expected[len(expected)-1]
+		if i < len(expected) {
+			want = expected[i]
+		}
+		if got := stream.NextToken(); got != want {
+			t.Errorf("Expected %d'th token to be %v but got %v", i, want, got)
+		}
+	}
+}
+
+func TestCommentsAndStringsSkipped(t *testing.T) {
+	lexer.TokenizeBuffer([]byte("/* a\n * b */ x \"c\nd\\\"\" y // e \"\nz /* unterminated"))
+	expected := []string{"x", "c\nd\\\"", "y", "z", "EOF"}
+	expectedRows := []int{2, 2, 3, 4, -1}
+	CheckExpectedNumberOfTokens(t, len(expected), len(lexer.Spans))
+	for i, span := range lexer.Spans {
+		if value := lexer.Value(span); value != expected[i] || lexer.SpanPos(span).Row != expectedRows[i] {
+			t.Errorf("Expected %d'th token to be '%s' on row %d but got '%s' on row %d", i, expected[i], expectedRows[i], value, lexer.SpanPos(span).Row)
+		}
+	}
+}
+
+func TestMinusAndDot(t *testing.T) {
+	lexer.TokenizeBuffer([]byte("x->y -1 x-1 .5 a.5 1.5.6 1.x -"))
+	expected := []string{"x", "->", "y", "-1", "x", "-", "1", ".5", "a", ".", "5", "1.5.6", "1", ".", "x", "-", "EOF"}
+	CheckExpectedNumberOfTokens(t, len(expected), len(lexer.Spans))
+	for i, span := range lexer.Spans {
+		if value := lexer.Value(span); value != expected[i] {
+			t.Errorf("Expected %d'th token to be '%s' but got '%s'", i, expected[i], value)
+		}
+	}
+}
+
+func TestSpanIsPacked(t *testing.T) {
+	if size := unsafe.Sizeof(ast.Span{}); size > 12 {
+		t.Errorf("Expected spans to be at most 12 bytes but they are %d", size)
+	}
+}
+
+func TestIdentifiersInterned(t *testing.T) {
+	lexer.Tokenize([]string{"x y x\n"})
+	if lexer.Tokens[0].Sym == 0 || lexer.Tokens[0].Sym != lexer.Tokens[2].Sym || lexer.Tokens[0].Sym == lexer.Tokens[1].Sym {
+		t.Errorf("Expected both 'x' to share a symbol that 'y' doesn't have but got %d, %d, %d", lexer.Tokens[0].Sym, lexer.Tokens[1].Sym, lexer.Tokens[2].Sym)
+	}
+	if name := lexer.Symbols.Name(lexer.Tokens[1].Sym); name != "y" {
+		t.Errorf("Expected symbol %d to be 'y' but got '%s'", lexer.Tokens[1].Sym, name)
+	}
+}
+
+func TestParallelMatchesTokenizeBuffer(t *testing.T) {
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(8))
+
+	// Long strings and comments make some chunks start inside of them
+	var src bytes.Buffer
+	for i := 0; src.Len() < 4<<20; i++ {
+		switch i % 4 {
+		case 0:
+			src.WriteString("fn main() -> i32 {\n\treturn x+y*5.0/-1 - 9\n}\n")
+		case 1:
+			src.WriteString("/* a block comment\n" + strings.Repeat("spanning lines\n", i%5000) + "*/\n")
+		case 2:
+			src.WriteString("const string s = \"a string\n" + strings.Repeat("spanning \\\" lines\n", i%3000) + "\"\n")
+		case 3:
+			src.WriteString("// a line comment \"\n")
+		}
+	}
+	src.WriteString("const string s = \"unterminated\n")
+
+	var sequential, parallel ast.Lexer
+	sequential.TokenizeBuffer(src.Bytes())
+	parallel.TokenizeParallel(src.Bytes())
+	if !reflect.DeepEqual(sequential.Spans, parallel.Spans) {
+		t.Errorf("Expected the same %d spans but got %d different ones", len(sequential.Spans), len(parallel.Spans))
+	}
+	if !reflect.DeepEqual(sequential.Lines, parallel.Lines) {
+		t.Errorf("Expected the same %d lines but got %d different ones", len(sequential.Lines), len(parallel.Lines))
+	}
+}
@@ -0,0 +1,72 @@
+# The tokens of pi that are always spelled the same way
+# `go generate ./ast` turns this into lexer_tables.go, don't edit that by hand
+#
+# Every line is the name of a TokenType (without the 'TokenType' prefix) and the token's text
+# Tokens marked 'single' end whatever word is being read, the rest are only recognized as a whole word
+# e.g. 'x+y' is three tokens but 'x==y' is one identifier
+# A token that starts with a single one (like '->') is read as one token wherever it appears
+#
+# Identifiers, numbers, strings and comments aren't listed, their rules live in internal/dfagen
+
+I64                    i64
+U64                    u64
+I32                    i32
+U32                    u32
+I16                    i16
+U16                    u16
+I8                     i8
+U8                     u8
+F64                    f64
+F32                    f32
+Bool                   bool
+String                 string
+Void                   void
+Nullptr                nullptr
+
+Package                package
+Fn                     fn
+If                     if
+For                    for
+Return                 return
+Import                 import
+Pub                    pub
+Mut                    mut
+Const                  const
+Type                   type
+While                  while
+Class                  class
+Constructor            constructor
+New                    new
+Interface              interface
+Struct                 struct
+
+CompareEq              ==
+CompareNe              !=
+CompareLt              <
+CompareGt              >
+CompareLtEq            <=
+CompareGtEq            >=
+And                    &&
+Or                     ||
+
+Colon                  :
+Semicolon              ;            single
+Comma                  ,            single
+Period                 .            single
+OpenParen              (            single
+CloseParen             )            single
+OpenCurlyBracket       {
+CloseCurlyBracket      }
+OpenSquareBracket      [
+CloseSquareBracket     ]
+
+Eq                     =
+Asterisk               *            single
+Slash                  /            single
+Plus                   +            single
+Minus                  -            single
+Arrow                  ->
+Ampersand              &
+
+True                   true
+False                  false
@@ -1,8 +1,12 @@
 package main
 
 import (
+	"crypto/sha256"
+	"encoding/hex"
 	"flag"
 	"fmt"
+	"io"
+	"os"
 
 	"github.com/IbrahimFadel/pi-lang/ast"
 	"github.com/IbrahimFadel/pi-lang/codegen"
@@ -10,35 +14,104 @@ import (
 	"github.com/IbrahimFadel/pi-lang/utils"
 )
 
+/*
+ * Part of every AST cache key, so ASTs cached by one build are never read by another
+ * It's a hash of the executable, any change to the parser makes a different one
+ * parser.ASTVersion is all there is if the executable can't be read
+ */
+func cacheVersion() string {
+	path, err := os.Executable()
+	if err != nil {
+		return parser.ASTVersion
+	}
+	exe, err := os.Open(path)
+	if err != nil {
+		return parser.ASTVersion
+	}
+	defer exe.Close()
+	hash := sha256.New()
+	if _, err := io.Copy(hash, exe); err != nil {
+		return parser.ASTVersion
+	}
+	return parser.ASTVersion + "-" + hex.EncodeToString(hash.Sum(nil))
+}
+
 func main() {
 	emitTokens := flag.Bool("emit-tokens", false, "print lexed tokens")
 	emitAst := flag.Bool("emit-ast", false, "print AST and write it to file")
 	emitIR := flag.Bool("emit-ir", false, "print IR and write it to file")
+	parallel := flag.Bool("parallel", false, "lex, parse and generate IR on every core")
+	ssa := flag.Bool("ssa", false, "keep local variables in SSA values instead of an alloca each")
+	cacheDir := flag.String("cache", "", "directory to keep parsed ASTs in, so unchanged files aren't parsed again")
 	flag.Parse()
 
-	fileContent := utils.ReadFileContent(flag.Arg(0))
-
+	var symbols ast.Interner
 	var lexer ast.Lexer
-	lexer.Tokenize(fileContent)
+	lexer.Symbols = &symbols
+	var arena ast.Arena
+	cache := parser.ASTCache{Dir: *cacheDir}
+	if *cacheDir != "" {
+		cache.Version = cacheVersion()
+	}
 
-	if *emitTokens {
-		fmt.Println("---- Tokens ----")
-		for _, value := range lexer.Tokens {
-			str := utils.PrettyPrint(value)
-			fmt.Println(str)
+	// Every file is parsed even if an earlier one has errors, so one run reports all of them
+	var nodes []ast.Node
+	errorCount := 0
+	for _, path := range flag.Args() {
+		src := utils.ReadFileBuffer(path)
+
+		if *emitTokens {
+			lexer.TokenizeParallel(src)
+			lexer.FillTokens()
+			fmt.Println("---- Tokens ----")
+			for _, value := range lexer.Tokens {
+				str := utils.PrettyPrint(value)
+				fmt.Println(str)
+			}
+			fmt.Println("----------------")
 		}
-		fmt.Println("----------------")
-	}
 
-	var parser parser.Parser
-	parser.GenerateAST(lexer.Tokens)
+		if *cacheDir != "" {
+			if cached, ok := cache.Load(src, &symbols, &arena); ok {
+				nodes = append(nodes, cached...)
+				continue
+			}
+		}
+
+		var parser parser.Parser
+		parser.Arena = &arena
+		parser.Recover = true
+		if *parallel {
+			lexer.TokenizeParallel(src)
+			lexer.FillTokens()
+			parser.GenerateASTParallel(lexer.Tokens)
+		} else {
+			lexer.Reset(src)
+			parser.GenerateASTFromLexer(&lexer)
+		}
+
+		for _, diag := range parser.Errors {
+			utils.Error(path + ": " + diag.String())
+		}
+		errorCount += len(parser.Errors)
+		nodes = append(nodes, parser.Nodes...)
+
+		if *cacheDir != "" && len(parser.Errors) == 0 {
+			if err := cache.Store(src, parser.Nodes, &lexer); err != nil {
+				utils.Error(fmt.Sprintf("could not cache AST of %s: %s", path, err.Error()))
+			}
+		}
+	}
+	if errorCount > 0 {
+		utils.FatalError(fmt.Sprintf("%d errors", errorCount))
+	}
 
 	if *emitAst {
 		var ast string
 		fmt.Print("\n\n")
 
 		fmt.Println("----- AST -----")
-		for _, value := range parser.Nodes {
+		for _, value := range nodes {
 			str := utils.PrettyPrint(value)
 			ast += str + ",\n"
 			fmt.Println(str)
@@ -49,7 +122,16 @@ func main() {
 	}
 
 	var gen codegen.IRGenerator
-	gen.GenerateIR(parser.Nodes)
+	gen.SSA = *ssa
+	if *parallel {
+		gen.GenerateIRParallel(nodes)
+	} else {
+		gen.GenerateIR(nodes)
+	}
+
+	// The AST isn't needed once there's IR
+	nodes = nil
+	arena.Reset()
 
 	if *emitIR {
 		fmt.Print("\n\n")
@@ -2,6 +2,7 @@ package codegen
 
 import (
 	"fmt"
+	"math/big"
 	"strconv"
 	"strings"
 
@@ -9,6 +10,7 @@ import (
 	"github.com/IbrahimFadel/pi-lang/utils"
 	"github.com/llir/llvm/ir"
 	"github.com/llir/llvm/ir/constant"
+	"github.com/llir/llvm/ir/enum"
 	"github.com/llir/llvm/ir/types"
 	"github.com/llir/llvm/ir/value"
 )
@@ -21,19 +23,50 @@ type IRGenerator struct {
 	CurBB        *ir.Block
 	CurBlockStmt *ast.BlockStmt
 
-	TypedefLLVMTypes map[string]*types.Type
+	TypedefLLVMTypes []types.Type // Indexed by Symbol
+	TypedefTypes     []ast.Expr   // Indexed by Symbol, the pi type each declared type names
+	Types            *TypeInterner
 
-	InterfaceTypeExprs   map[string]*ast.InterfaceTypeExpr
-	InterfaceVTableTypes map[string]*types.StructType
-	InterfaceVTables     map[string]*constant.Struct
+	InterfaceTypeExprs   map[ast.Symbol]*ast.InterfaceTypeExpr
+	InterfaceVTableTypes map[ast.Symbol]*types.StructType
+	InterfaceVTables     map[ast.Symbol]*constant.Struct
+	MethodIndex          MethodIndex
 	CurTypeDeclName      string
+	CurTypeDeclSym       ast.Symbol
+
+	LocalTypes map[ast.Symbol]ast.Expr       // Types locals of the current function were declared with
+	Slots      map[ast.Symbol]*ir.InstAlloca // Allocas of the current function's locals without SSA, assigning stores to them and '&' gives them
+
+	SSA          bool // Keep locals in SSA values instead of giving each one an alloca, only locals whose address is taken live in memory
+	Locals       SSABuilder
+	AddressTaken map[ast.Symbol]bool // Locals of the current function that need an alloca even if they're constant or kept in SSA values
 }
 
 func (gen *IRGenerator) Init() {
-	gen.TypedefLLVMTypes = make(map[string]*types.Type)
-	gen.InterfaceTypeExprs = make(map[string]*ast.InterfaceTypeExpr)
-	gen.InterfaceVTableTypes = make(map[string]*types.StructType)
-	gen.InterfaceVTables = make(map[string]*constant.Struct)
+	gen.TypedefLLVMTypes = nil
+	gen.TypedefTypes = nil
+	gen.Types = &TypeInterner{}
+	gen.InterfaceTypeExprs = make(map[ast.Symbol]*ast.InterfaceTypeExpr)
+	gen.InterfaceVTableTypes = make(map[ast.Symbol]*types.StructType)
+	gen.InterfaceVTables = make(map[ast.Symbol]*constant.Struct)
+	gen.MethodIndex.Init()
+}
+
+// Get the LLVM type of the type declared with the name sym
+func (gen *IRGenerator) Typedef(sym ast.Symbol) (types.Type, bool) {
+	if int(sym) < len(gen.TypedefLLVMTypes) && gen.TypedefLLVMTypes[sym] != nil {
+		return gen.TypedefLLVMTypes[sym], true
+	}
+	return nil, false
+}
+
+func (gen *IRGenerator) AddTypedef(sym ast.Symbol, ty types.Type, piType ast.Expr) {
+	for int(sym) >= len(gen.TypedefLLVMTypes) {
+		gen.TypedefLLVMTypes = append(gen.TypedefLLVMTypes, nil)
+		gen.TypedefTypes = append(gen.TypedefTypes, nil)
+	}
+	gen.TypedefLLVMTypes[sym] = ty
+	gen.TypedefTypes[sym] = piType
 }
 
 func (gen *IRGenerator) GenerateIR(ast []ast.Node) {
@@ -49,74 +82,380 @@ func (gen *IRGenerator) Node(node ast.Node) {
 	switch n := node.(type) {
 	default:
 		utils.FatalError(fmt.Sprintf("could not codegen node of type: %v", n))
-	case ast.FuncDecl:
+	case *ast.FuncDecl:
 		gen.FuncDecl(n)
-	case ast.ReturnStmt:
+	case *ast.ReturnStmt:
 		gen.ReturnStmt(n)
-	case ast.VarDecl:
+	case *ast.VarDecl:
 		gen.VarDecl(n)
-	case ast.TypeDecl:
+	case *ast.TypeDecl:
 		gen.TypeDecl(n)
+	case *ast.BinaryExpr:
+		if n.Op != ast.TokenTypeEq {
+			utils.FatalError(fmt.Sprintf("could not codegen node of type: %v", n))
+		}
+		gen.Assign(n)
 	}
 }
 
-func (gen *IRGenerator) TypeDecl(typeDecl ast.TypeDecl) {
+func (gen *IRGenerator) TypeDecl(typeDecl *ast.TypeDecl) {
 	gen.CurTypeDeclName = typeDecl.Name // TODO: ew refactor... need a better way to do this
+	gen.CurTypeDeclSym = typeDecl.Sym
 	ty, err := gen.Type(typeDecl.Type)
 	if err != nil {
 		utils.FatalError(fmt.Sprintf("could not codegen type value in type declaration: %s", err.Error()))
 	}
 
-	gen.TypedefLLVMTypes[gen.CurTypeDeclName] = &ty
+	// Other types are shared by everything that uses them, so naming one needs a copy of its own
+	switch t := ty.(type) {
+	case *types.IntType:
+		named := *t
+		ty = &named
+	case *types.FloatType:
+		named := *t
+		ty = &named
+	case *types.PointerType:
+		named := *t
+		ty = &named
+	}
+
+	gen.AddTypedef(gen.CurTypeDeclSym, ty, typeDecl.Type)
 	gen.Module.NewTypeDef(typeDecl.Name, ty)
 }
 
-func (gen *IRGenerator) VarDecl(varDecl ast.VarDecl) {
+func (gen *IRGenerator) VarDecl(varDecl *ast.VarDecl) {
 	ty, err := gen.Type(varDecl.Type)
 	if err != nil {
 		utils.FatalError(fmt.Sprintf("could not codegen type: %s", err.Error()))
 	}
 
 	for i, v := range varDecl.Values {
-		ptr := gen.CurBB.NewAlloca(ty)
+		sym := varDecl.Syms[i]
+		gen.LocalTypes[sym] = varDecl.Type
 		val, err := gen.Expr(v)
 		if err != nil {
 			utils.FatalError(fmt.Sprintf("could not codegen const declaration expression: %s", err.Error()))
 		}
+		if !val.Type().Equal(ty) {
+			utils.FatalError(fmt.Sprintf("could not codegen declaration of '%s': its value isn't the type it's declared with", varDecl.Names[i]))
+		}
+
+		if gen.SSA {
+			local := gen.Locals.Declare(sym, ty, varDecl.Mut, gen.AddressTaken[sym])
+			gen.WriteLocal(sym, local, val)
+			continue
+		}
+
+		// A constant that's known at compile time doesn't need to be kept anywhere, unless its address is taken
+		if _, isConstant := val.(constant.Constant); isConstant && !varDecl.Mut && !gen.AddressTaken[sym] {
+			gen.CurBlockStmt.Constants[sym] = val
+			continue
+		}
+
+		ptr := gen.CurBB.NewAlloca(ty)
 		gen.CurBB.NewStore(val, ptr)
 		loaded := gen.CurBB.NewLoad(ty, ptr)
+		gen.Slots[sym] = ptr
 		if varDecl.Mut {
-			gen.CurBlockStmt.Mutables[varDecl.Names[i]] = loaded
+			gen.CurBlockStmt.Mutables[varDecl.Syms[i]] = loaded
 		} else {
-			gen.CurBlockStmt.Constants[varDecl.Names[i]] = loaded
+			gen.CurBlockStmt.Constants[varDecl.Syms[i]] = loaded
 		}
 	}
 }
 
+// Codegen 'x = y'
+func (gen *IRGenerator) Assign(assign *ast.BinaryExpr) {
+	ref, ok := assign.X.(*ast.VarRefExpr)
+	if !ok {
+		utils.FatalError("could not codegen assignment: can only assign to variables")
+	}
+	val, err := gen.Expr(assign.Y)
+	if err != nil {
+		utils.FatalError(fmt.Sprintf("could not codegen assignment: %s", err.Error()))
+	}
+
+	if gen.SSA {
+		local, found := gen.Locals.Vars[ref.Sym]
+		if !found || !local.Mut {
+			utils.FatalError(fmt.Sprintf("could not codegen assignment: '%s' is not a mutable variable", ref.Name))
+		}
+		gen.CheckAssignType(ref, val, local.Type)
+		gen.WriteLocal(ref.Sym, local, val)
+		return
+	}
+
+	ptr, found := gen.Slots[ref.Sym]
+	if _, mutable := gen.CurBlockStmt.Mutables[ref.Sym]; !found || !mutable {
+		utils.FatalError(fmt.Sprintf("could not codegen assignment: '%s' is not a mutable variable", ref.Name))
+	}
+	gen.CheckAssignType(ref, val, ptr.ElemType)
+	gen.CurBB.NewStore(val, ptr)
+	gen.CurBlockStmt.Mutables[ref.Sym] = gen.CurBB.NewLoad(ptr.ElemType, ptr)
+}
+
+// The same check VarDecl does on a local's value
+func (gen *IRGenerator) CheckAssignType(ref *ast.VarRefExpr, val value.Value, ty types.Type) {
+	if !val.Type().Equal(ty) {
+		utils.FatalError(fmt.Sprintf("could not codegen assignment to '%s': its value isn't the type it's declared with", ref.Name))
+	}
+}
+
+// Give a local a new value, in its alloca if it has one or as the value it has from here on in CurBB
+func (gen *IRGenerator) WriteLocal(sym ast.Symbol, local *SSAVar, val value.Value) {
+	if local.Slot != nil {
+		gen.CurBB.NewStore(val, local.Slot)
+	} else {
+		gen.Locals.WriteVariable(sym, gen.CurBB, val)
+	}
+}
+
 func (gen *IRGenerator) Expr(expr ast.Expr) (value.Value, error) {
 	switch e := expr.(type) {
 	default:
 		fmt.Println(utils.PrettyPrint(e))
 		return constant.NewInt(types.I32, 0), fmt.Errorf("unimplemented expression type")
-	case ast.NumberLitExpr:
+	case *ast.NumberLitExpr:
 		return gen.NumberLitExpr(e)
-	case ast.NullExpr:
+	case *ast.NullExpr:
 		return gen.NullExpr(e)
-	case ast.VarRefExpr:
+	case *ast.VarRefExpr:
 		return gen.VarRefExpr(e)
+	case *ast.UnaryExpr:
+		return gen.UnaryExpr(e)
+	case *ast.BinaryExpr:
+		return gen.BinaryExpr(e)
+	}
+}
+
+func (gen *IRGenerator) BinaryExpr(binary *ast.BinaryExpr) (value.Value, error) {
+	errVal := constant.NewInt(types.I32, 0)
+	x, err := gen.Expr(binary.X)
+	if err != nil {
+		return errVal, err
+	}
+	y, err := gen.Expr(binary.Y)
+	if err != nil {
+		return errVal, err
+	}
+	// Only division and comparisons care about signedness
+	unsigned := false
+	if _, isCompare := iPreds[binary.Op]; isCompare || binary.Op == ast.TokenTypeSlash {
+		unsigned = gen.IsUnsigned(binary)
+	}
+	if folded, ok, err := FoldBinary(binary.Op, x, y, unsigned); ok || err != nil {
+		if err != nil {
+			return errVal, err
+		}
+		return folded, nil
+	}
+	if !x.Type().Equal(y.Type()) {
+		return errVal, fmt.Errorf("mismatched types in binary expression")
+	}
+
+	if types.IsFloat(x.Type()) {
+		switch binary.Op {
+		case ast.TokenTypePlus:
+			return gen.CurBB.NewFAdd(x, y), nil
+		case ast.TokenTypeMinus:
+			return gen.CurBB.NewFSub(x, y), nil
+		case ast.TokenTypeAsterisk:
+			return gen.CurBB.NewFMul(x, y), nil
+		case ast.TokenTypeSlash:
+			return gen.CurBB.NewFDiv(x, y), nil
+		}
+		if pred, ok := fPreds[binary.Op]; ok {
+			return gen.CurBB.NewFCmp(pred, x, y), nil
+		}
+		return errVal, fmt.Errorf("unimplemented binary operator on floats")
+	}
+
+	switch binary.Op {
+	case ast.TokenTypePlus:
+		return gen.CurBB.NewAdd(x, y), nil
+	case ast.TokenTypeMinus:
+		return gen.CurBB.NewSub(x, y), nil
+	case ast.TokenTypeAsterisk:
+		return gen.CurBB.NewMul(x, y), nil
+	case ast.TokenTypeSlash:
+		if unsigned {
+			return gen.CurBB.NewUDiv(x, y), nil
+		}
+		return gen.CurBB.NewSDiv(x, y), nil
+	case ast.TokenTypeAnd, ast.TokenTypeOr:
+		if _, isInt := x.Type().(*types.IntType); !isInt {
+			return errVal, fmt.Errorf("'&&' and '||' need integer operands")
+		}
+		if binary.Op == ast.TokenTypeAnd {
+			return gen.CurBB.NewAnd(gen.Truth(x), gen.Truth(y)), nil
+		}
+		return gen.CurBB.NewOr(gen.Truth(x), gen.Truth(y)), nil
+	}
+	preds := iPreds
+	if unsigned {
+		preds = uPreds
+	}
+	if pred, ok := preds[binary.Op]; ok {
+		return gen.CurBB.NewICmp(pred, x, y), nil
+	}
+	return errVal, fmt.Errorf("unimplemented binary operator")
+}
+
+var (
+	iPreds = map[ast.TokenType]enum.IPred{
+		ast.TokenTypeCompareLt: enum.IPredSLT, ast.TokenTypeCompareGt: enum.IPredSGT,
+		ast.TokenTypeCompareLtEq: enum.IPredSLE, ast.TokenTypeCompareGtEq: enum.IPredSGE,
+		ast.TokenTypeCompareEq: enum.IPredEQ, ast.TokenTypeCompareNe: enum.IPredNE,
+	}
+	uPreds = map[ast.TokenType]enum.IPred{
+		ast.TokenTypeCompareLt: enum.IPredULT, ast.TokenTypeCompareGt: enum.IPredUGT,
+		ast.TokenTypeCompareLtEq: enum.IPredULE, ast.TokenTypeCompareGtEq: enum.IPredUGE,
+		ast.TokenTypeCompareEq: enum.IPredEQ, ast.TokenTypeCompareNe: enum.IPredNE,
+	}
+	fPreds = map[ast.TokenType]enum.FPred{
+		ast.TokenTypeCompareLt: enum.FPredOLT, ast.TokenTypeCompareGt: enum.FPredOGT,
+		ast.TokenTypeCompareLtEq: enum.FPredOLE, ast.TokenTypeCompareGtEq: enum.FPredOGE,
+		ast.TokenTypeCompareEq: enum.FPredOEQ, ast.TokenTypeCompareNe: enum.FPredONE,
+	}
+)
+
+// Whether the integer x isn't 0, as an i1 like FoldBinary gives for '&&' and '||'
+func (gen *IRGenerator) Truth(x value.Value) value.Value {
+	ty := x.Type().(*types.IntType)
+	if ty.BitSize == 1 {
+		return x
+	}
+	return gen.CurBB.NewICmp(enum.IPredNE, x, constant.NewInt(ty, 0))
+}
+
+func (gen *IRGenerator) UnaryExpr(unary *ast.UnaryExpr) (value.Value, error) {
+	errVal := constant.NewInt(types.I32, 0)
+
+	// '&local' is the local's alloca
+	if unary.Op == ast.TokenTypeAmpersand {
+		if ref, ok := unary.X.(*ast.VarRefExpr); ok {
+			if gen.SSA {
+				if local, found := gen.Locals.Vars[ref.Sym]; found && local.Slot != nil {
+					return local.Slot, nil
+				}
+			} else if ptr, found := gen.Slots[ref.Sym]; found {
+				return ptr, nil
+			}
+		}
+		return errVal, fmt.Errorf("can only take the address of a local variable")
 	}
+
+	x, err := gen.Expr(unary.X)
+	if err != nil {
+		return errVal, err
+	}
+	if folded, ok := FoldUnary(unary.Op, x); ok {
+		return folded, nil
+	}
+	switch unary.Op {
+	case ast.TokenTypeMinus:
+		if types.IsFloat(x.Type()) {
+			return gen.CurBB.NewFNeg(x), nil
+		}
+		return gen.CurBB.NewSub(constant.NewInt(x.Type().(*types.IntType), 0), x), nil
+	case ast.TokenTypeAsterisk:
+		ptrTy, ok := x.Type().(*types.PointerType)
+		if !ok {
+			return errVal, fmt.Errorf("can only dereference pointers")
+		}
+		return gen.CurBB.NewLoad(ptrTy.ElemType, x), nil
+	}
+	return errVal, fmt.Errorf("unimplemented unary operator")
+}
+
+/*
+ * Whether expr has an unsigned integer type
+ * Locals and what their pointers point to have the types they were declared with, the first operand found with one decides
+ * A literal's type only comes from where it's used, so it's only gone by if nothing in expr has a declared type
+ */
+func (gen *IRGenerator) IsUnsigned(expr ast.Expr) bool {
+	var literal ast.Expr
+	stack := []ast.Expr{expr}
+	for len(stack) > 0 {
+		e := stack[len(stack)-1]
+		stack = stack[:len(stack)-1]
+		switch e := e.(type) {
+		case *ast.NumberLitExpr:
+			if literal == nil {
+				literal = e.Type
+			}
+		case *ast.VarRefExpr:
+			if ty, found := gen.LocalTypes[e.Sym]; found {
+				return gen.IsUnsignedType(ty)
+			}
+		case *ast.BinaryExpr:
+			stack = append(stack, e.Y, e.X)
+		case *ast.UnaryExpr:
+			if e.Op == ast.TokenTypeAsterisk {
+				if ptr, ok := gen.PointeeType(e.X); ok {
+					return gen.IsUnsignedType(ptr)
+				}
+				continue
+			}
+			stack = append(stack, e.X)
+		}
+	}
+	return gen.IsUnsignedType(literal)
+}
+
+// The type x points to, if x is a local declared as a pointer
+func (gen *IRGenerator) PointeeType(x ast.Expr) (ast.Expr, bool) {
+	if ref, ok := x.(*ast.VarRefExpr); ok {
+		if ptr, ok := gen.ResolveType(gen.LocalTypes[ref.Sym]).(*ast.PointerTypeExpr); ok {
+			return ptr.PointerToType, true
+		}
+	}
+	return nil, false
+}
+
+// ty with declared type names replaced by what they name, as far as it takes to get to a type that isn't a name
+func (gen *IRGenerator) ResolveType(ty ast.Expr) ast.Expr {
+	// Bounded so a type that names itself can't loop forever
+	for i := 0; i <= len(gen.TypedefTypes); i++ {
+		ident, ok := ty.(*ast.IdentifierExpr)
+		if !ok || int(ident.Sym) >= len(gen.TypedefTypes) || gen.TypedefTypes[ident.Sym] == nil {
+			return ty
+		}
+		ty = gen.TypedefTypes[ident.Sym]
+	}
+	return ty
 }
 
-func (gen *IRGenerator) VarRefExpr(ref ast.VarRefExpr) (value.Value, error) {
-	if v, found := gen.CurBlockStmt.Constants[ref.Name]; found {
+func (gen *IRGenerator) IsUnsignedType(ty ast.Expr) bool {
+	if prim, ok := gen.ResolveType(ty).(*ast.PrimitiveTypeExpr); ok {
+		switch prim.PrimitiveType {
+		case ast.TokenTypeU8, ast.TokenTypeU16, ast.TokenTypeU32, ast.TokenTypeU64:
+			return true
+		}
+	}
+	return false
+}
+
+func (gen *IRGenerator) VarRefExpr(ref *ast.VarRefExpr) (value.Value, error) {
+	if gen.SSA {
+		local, found := gen.Locals.Vars[ref.Sym]
+		if !found {
+			return constant.False, fmt.Errorf("could not find variable '%s'", ref.Name)
+		}
+		if local.Slot != nil {
+			return gen.CurBB.NewLoad(local.Type, local.Slot), nil
+		}
+		return gen.Locals.ReadVariable(ref.Sym, gen.CurBB), nil
+	}
+	if v, found := gen.CurBlockStmt.Constants[ref.Sym]; found {
 		return v, nil
-	} else if v, found := gen.CurBlockStmt.Mutables[ref.Name]; found {
+	} else if v, found := gen.CurBlockStmt.Mutables[ref.Sym]; found {
 		return v, nil
 	}
 	return constant.False, fmt.Errorf("could not find variable '%s'", ref.Name)
 }
 
-func (gen *IRGenerator) NullExpr(nullExpr ast.NullExpr) (value.Value, error) {
+func (gen *IRGenerator) NullExpr(nullExpr *ast.NullExpr) (value.Value, error) {
 	ty, err := gen.Type(nullExpr.Type)
 	if err != nil {
 		return constant.NewNull(types.I32Ptr), fmt.Errorf("could not generate null expression type: %s", err.Error())
@@ -124,7 +463,7 @@ func (gen *IRGenerator) NullExpr(nullExpr ast.NullExpr) (value.Value, error) {
 	return gen.CurBB.NewLoad(ty, constant.NewNull(&types.PointerType{ElemType: ty})), nil
 }
 
-func (gen *IRGenerator) NumberLitExpr(num ast.NumberLitExpr) (value.Value, error) {
+func (gen *IRGenerator) NumberLitExpr(num *ast.NumberLitExpr) (value.Value, error) {
 	errVal := constant.NewInt(types.I32, 0)
 	ty, err := gen.Type(num.Type)
 	if err != nil {
@@ -156,17 +495,17 @@ func (gen *IRGenerator) NumberLitExpr(num ast.NumberLitExpr) (value.Value, error
 		if !ok {
 			return errVal, fmt.Errorf("could not cast type to int type")
 		}
-		val, err := strconv.Atoi(num.Value)
-		if err != nil {
+		val, ok := new(big.Int).SetString(num.Value, 10)
+		if !ok {
 			return errVal, fmt.Errorf("could not convert %s to int", num.Value)
 		}
-		return constant.NewInt(intTy, int64(val)), nil
+		return wrapInt(intTy, val), nil
 	}
 
 	return errVal, fmt.Errorf("number literal of unknown type") // I don't think this can be reached
 }
 
-func (gen *IRGenerator) ReturnStmt(ret ast.ReturnStmt) {
+func (gen *IRGenerator) ReturnStmt(ret *ast.ReturnStmt) {
 	val, err := gen.Expr(ret.Value)
 	if err != nil {
 		utils.FatalError(fmt.Sprintf("could not codegen expression: %s", err.Error()))
@@ -174,7 +513,16 @@ func (gen *IRGenerator) ReturnStmt(ret ast.ReturnStmt) {
 	gen.CurBB.NewRet(val)
 }
 
-func (gen *IRGenerator) FuncDecl(fnDecl ast.FuncDecl) {
+func (gen *IRGenerator) FuncDecl(fnDecl *ast.FuncDecl) {
+	fn := gen.DeclareFunc(fnDecl)
+	if err := fnDecl.ExpandBody(); err != nil {
+		utils.FatalError(fmt.Sprintf("could not parse body of '%s':\n%s", fnDecl.Name, err.Error()))
+	}
+	gen.FuncBody(fnDecl, fn)
+}
+
+// Add fnDecl's function to the module and to the vtable of the interface it implements, without its body
+func (gen *IRGenerator) DeclareFunc(fnDecl *ast.FuncDecl) *ir.Func {
 	retType, err := gen.Type(fnDecl.FuncType.Return)
 	if err != nil {
 		utils.FatalError(fmt.Sprintf("could not codegen function declaration: %s", err.Error()))
@@ -202,37 +550,41 @@ func (gen *IRGenerator) FuncDecl(fnDecl ast.FuncDecl) {
 	}
 
 	fnName := fnDecl.Name
-	implementsInterface := false
-	var interfaceImplementedName string
-
+	var slots []MethodSlot
+	var receiverSym ast.Symbol
 	if hasReceiver {
-		for interfaceName, knownInterface := range gen.InterfaceTypeExprs {
-			if gen.FnImplementsInterface(fnDecl, interfaceName, knownInterface) {
-				structName := gen.FindTypeExprName(fnDecl.Receiver.Type)
-				fnName = structName + "_" + fnName
-				implementsInterface = true
-				interfaceImplementedName = interfaceName
-				break
-			}
+		var ok bool
+		if receiverSym, ok = ReceiverSym(fnDecl.Receiver.Type); !ok {
+			utils.FatalError("could not find type expression name")
+		}
+		slots = gen.MethodSlots(fnDecl)
+		if len(slots) > 0 {
+			fnName = gen.FindTypeExprName(fnDecl.Receiver.Type) + "_" + fnName
 		}
 	}
 
 	fn := gen.Module.NewFunc(fnName, retType, params...)
-
-	if implementsInterface {
-		vTableType := gen.InterfaceVTableTypes[interfaceImplementedName]
-		vTableType.Fields = append(vTableType.Fields, fn.Type())
-
-		vTableData := gen.InterfaceVTables[interfaceImplementedName]
-		vTableData.Fields = append(vTableData.Fields, fn)
+	if len(slots) > 0 {
+		gen.AddMethod(receiverSym, fn, slots)
 	}
+	return fn
+}
 
+// Generate the body of fn, which DeclareFunc made for fnDecl, fnDecl's body has to have been expanded already
+func (gen *IRGenerator) FuncBody(fnDecl *ast.FuncDecl, fn *ir.Func) {
 	gen.CurBB = fn.NewBlock(fnDecl.Body.Name)
 	gen.CurBlockStmt = &fnDecl.Body
-	gen.BlockStmt(fnDecl.Body)
+	gen.LocalTypes = make(map[ast.Symbol]ast.Expr)
+	gen.Slots = make(map[ast.Symbol]*ir.InstAlloca)
+	gen.AddressTaken = AddressTaken(&fnDecl.Body)
+	if gen.SSA {
+		gen.Locals.Init(fn)
+		gen.Locals.SealBlock(gen.CurBB) // Nothing branches to the entry block
+	}
+	gen.BlockStmt(&fnDecl.Body)
 
 	if gen.CurBB.Term == nil {
-		if retType != types.Void {
+		if fn.Sig.RetType != types.Void {
 			utils.FatalError(fmt.Sprintf("missing return statement in function '%s'", fnDecl.Name))
 		}
 		gen.CurBB.NewRet(nil)
@@ -244,116 +596,53 @@ func (gen *IRGenerator) FindTypeExprName(ty ast.Expr) string {
 	default:
 		utils.FatalError("could not find type expression name")
 		return "" // useless but for ide to not complain
-	case ast.PointerTypeExpr:
+	case *ast.PointerTypeExpr:
 		return gen.FindTypeExprName(t.PointerToType)
-	case ast.IdentifierExpr:
+	case *ast.IdentifierExpr:
 		return t.Name
 	}
 }
 
-func (gen *IRGenerator) FnImplementsInterface(fn ast.FuncDecl, interfaceName string, interfaceTy *ast.InterfaceTypeExpr) bool {
-	// .... this shouldnt be this bad... so many loops. find a better way
-
-	fnRetTy, err := gen.Type(fn.FuncType.Return)
-	if err != nil {
-		utils.FatalError("could not codegen function return type")
-	}
-
-	for _, method := range interfaceTy.Methods.Methods {
-
-		if fn.Name != method.Name {
-			return false
-		}
-
-		methodRetTy, err := gen.Type(method.Return)
-		if err != nil {
-			utils.FatalError("could not codegen method return type")
-		}
-
-		if fnRetTy != methodRetTy {
-			return false
-		}
-
-		for _, methodParam := range method.Params.Params {
-			methodParamTy, err := gen.Type(methodParam.Type)
-			if err != nil {
-				utils.FatalError("could not codegen method param type")
-			}
-
-			for _, fnParam := range fn.FuncType.Params.Params {
-				fnParamTy, err := gen.Type(fnParam.Type)
-				if err != nil {
-					utils.FatalError("could not codegen function param type")
-				}
-
-				if methodParamTy != fnParamTy {
-					return false
-				}
-			}
-		}
-	}
-
-	return true
-}
-
-func (gen *IRGenerator) BlockStmt(block ast.BlockStmt) {
+func (gen *IRGenerator) BlockStmt(block *ast.BlockStmt) {
 	for _, stmt := range block.List {
 		gen.Node(stmt)
 	}
 }
 
+// The LLVM type of the pi type ty, every type is only lowered once, see TypeInterner
 func (gen *IRGenerator) Type(ty ast.Expr) (types.Type, error) {
-	switch t := ty.(type) {
-	default:
-		fmt.Println(utils.PrettyPrint(t))
-		return types.Void, fmt.Errorf("could not convert pi type to llvm type")
-	case ast.PrimitiveTypeExpr:
-		return gen.PrimitiveTypeExpr(t)
-	case ast.PointerTypeExpr:
-		return gen.PointerTypeExpr(t)
-	case ast.VoidExpr:
-		return gen.VoidExpr(t)
-	case ast.StructTypeExpr:
-		return gen.StructTypeExpr(t)
-	case ast.InterfaceTypeExpr:
-		return gen.InterfaceTypeExpr(t)
-	case ast.IdentifierExpr:
-		if idType, ok := gen.TypedefLLVMTypes[t.Name]; ok {
-			return *idType, nil
-		} else if idType, ok := gen.TypedefLLVMTypes[t.Name]; ok {
-			return *idType, nil
-		} else if idType, ok := gen.TypedefLLVMTypes[t.Name]; ok {
-			return *idType, nil
-		} else {
-			return types.Void, fmt.Errorf("could not convert pi type to llvm type")
-		}
+	id, err := gen.TypeID(ty)
+	if err != nil {
+		return types.Void, err
 	}
+	return gen.Types.Type(id), nil
 }
 
-func (gen *IRGenerator) VoidExpr(_ ast.VoidExpr) (types.Type, error) {
+func (gen *IRGenerator) VoidExpr(_ *ast.VoidExpr) (types.Type, error) {
 	return types.Void, nil
 }
 
-func (gen *IRGenerator) InterfaceTypeExpr(ty ast.InterfaceTypeExpr) (types.Type, error) {
+func (gen *IRGenerator) InterfaceTypeExpr(ty *ast.InterfaceTypeExpr) (types.Type, error) {
 	structTy := types.StructType{}
 	gen.Module.NewTypeDef(gen.CurTypeDeclName, &structTy)
 
 	vtableType := types.StructType{}
 
 	gen.Module.NewTypeDef(gen.CurTypeDeclName+"_VTable_Type", &vtableType)
-	gen.InterfaceVTableTypes[gen.CurTypeDeclName] = &vtableType
+	gen.InterfaceVTableTypes[gen.CurTypeDeclSym] = &vtableType
 
 	structTy.Fields = append(structTy.Fields, types.NewPointer(&vtableType))
 
 	vTableData := constant.NewStruct(&vtableType)
 	gen.Module.NewGlobalDef(gen.CurTypeDeclName+"_VTable_Data", vTableData)
-	gen.InterfaceVTables[gen.CurTypeDeclName] = vTableData
-	gen.InterfaceTypeExprs[gen.CurTypeDeclName] = &ty
+	gen.InterfaceVTables[gen.CurTypeDeclSym] = vTableData
+	gen.InterfaceTypeExprs[gen.CurTypeDeclSym] = ty
+	gen.MethodIndex.Pending = append(gen.MethodIndex.Pending, gen.CurTypeDeclSym)
 
 	return &structTy, nil
 }
 
-func (gen *IRGenerator) StructTypeExpr(ty ast.StructTypeExpr) (types.Type, error) {
+func (gen *IRGenerator) StructTypeExpr(ty *ast.StructTypeExpr) (types.Type, error) {
 	var structPropertyTypes []types.Type
 
 	for _, props := range ty.Properties.Properties {
@@ -372,16 +661,7 @@ func (gen *IRGenerator) StructTypeExpr(ty ast.StructTypeExpr) (types.Type, error
 	return &structTy, nil
 }
 
-func (gen *IRGenerator) PointerTypeExpr(ty ast.PointerTypeExpr) (types.Type, error) {
-	ptrTo, err := gen.Type(ty.PointerToType)
-	if err != nil {
-		return types.Void, fmt.Errorf("could not convert pointer type to llvmm type: %s", err.Error())
-	}
-	ptrTy := types.PointerType{ElemType: ptrTo}
-	return &ptrTy, nil
-}
-
-func (gen *IRGenerator) PrimitiveTypeExpr(ty ast.PrimitiveTypeExpr) (types.Type, error) {
+func (gen *IRGenerator) PrimitiveTypeExpr(ty *ast.PrimitiveTypeExpr) (types.Type, error) {
 	switch ty.PrimitiveType {
 	default:
 		return types.Void, fmt.Errorf("could not convert type %d to LLVM type", ty.PrimitiveType)
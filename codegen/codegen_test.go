@@ -0,0 +1,406 @@
+package codegen_test
+
+import (
+	"fmt"
+	"reflect"
+	"runtime"
+	"strings"
+	"testing"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/codegen"
+	"github.com/IbrahimFadel/pi-lang/parser"
+	"github.com/llir/llvm/ir"
+	"github.com/llir/llvm/ir/constant"
+	"github.com/llir/llvm/ir/types"
+	"github.com/llir/llvm/ir/value"
+)
+
+// Parse src, which has to be free of errors, and the Interner its Symbols are from
+func Parse(t *testing.T, src string) ([]ast.Node, *ast.Interner) {
+	var lexer ast.Lexer
+	lexer.Reset([]byte(src))
+	var p parser.Parser
+	p.Recover = true
+	p.GenerateASTFromLexer(&lexer)
+	if len(p.Errors) > 0 {
+		t.Fatalf("Could not parse %q: %v", src, p.Errors)
+	}
+	return p.Nodes, lexer.Symbols
+}
+
+func Phis(block *ir.Block) []*ir.InstPhi {
+	var phis []*ir.InstPhi
+	for _, inst := range block.Insts {
+		if phi, ok := inst.(*ir.InstPhi); ok {
+			phis = append(phis, phi)
+		}
+	}
+	return phis
+}
+
+// The value phi gets from pred
+func Incoming(phi *ir.InstPhi, pred *ir.Block) value.Value {
+	for _, inc := range phi.Incs {
+		if inc.Pred == value.Value(pred) {
+			return inc.X
+		}
+	}
+	return nil
+}
+
+const x, y ast.Symbol = 1, 2
+
+func NewSSAFunc() (*codegen.SSABuilder, *ir.Func) {
+	fn := ir.NewModule().NewFunc("f", types.I32, ir.NewParam("a", types.I32))
+	var ssa codegen.SSABuilder
+	ssa.Init(fn)
+	ssa.Declare(x, types.I32, true, false)
+	ssa.Declare(y, types.I32, true, false)
+	return &ssa, fn
+}
+
+/*
+ * entry -> then -> join
+ *       -> else -> join
+ * x is written in then, so join needs a phi for it, y is only written in entry so its phi is trivial
+ */
+func TestSSADiamond(t *testing.T) {
+	ssa, fn := NewSSAFunc()
+	a := fn.Params[0]
+	entry, then, els, join := fn.NewBlock("entry"), fn.NewBlock("then"), fn.NewBlock("else"), fn.NewBlock("join")
+	ssa.SealBlock(entry)
+	ssa.WriteVariable(x, entry, a)
+	ssa.WriteVariable(y, entry, a)
+
+	ssa.AddEdge(entry, then)
+	ssa.AddEdge(entry, els)
+	ssa.SealBlock(then)
+	ssa.SealBlock(els)
+	sum := then.NewAdd(ssa.ReadVariable(x, then), constant.NewInt(types.I32, 1))
+	ssa.WriteVariable(x, then, sum)
+
+	ssa.AddEdge(then, join)
+	ssa.AddEdge(els, join)
+	ssa.SealBlock(join)
+	phi, ok := ssa.ReadVariable(x, join).(*ir.InstPhi)
+	if !ok {
+		t.Fatalf("Expected x to be a phi in the join block")
+	}
+	if Incoming(phi, then) != value.Value(sum) || Incoming(phi, els) != value.Value(a) {
+		t.Errorf("Expected x's phi to merge the sum from 'then' and the parameter from 'else'")
+	}
+	if val := ssa.ReadVariable(y, join); val != value.Value(a) {
+		t.Errorf("Expected y's trivial phi to be replaced by the parameter")
+	}
+	if phis := Phis(join); len(phis) != 1 || phis[0] != phi {
+		t.Errorf("Expected only x's phi in the join block but there are %d phis", len(phis))
+	}
+}
+
+/*
+ * entry -> header -> body -> header
+ *                 -> exit
+ * header is only sealed once the back edge from body is known, y is never written in the loop so its phi goes away
+ */
+func TestSSALoop(t *testing.T) {
+	ssa, fn := NewSSAFunc()
+	a := fn.Params[0]
+	zero := constant.NewInt(types.I32, 0)
+	entry, header, body, exit := fn.NewBlock("entry"), fn.NewBlock("header"), fn.NewBlock("body"), fn.NewBlock("exit")
+	ssa.SealBlock(entry)
+	ssa.WriteVariable(x, entry, zero)
+	ssa.WriteVariable(y, entry, a)
+
+	ssa.AddEdge(entry, header)
+	ssa.AddEdge(header, body)
+	ssa.SealBlock(body)
+	sum := body.NewAdd(ssa.ReadVariable(x, body), ssa.ReadVariable(y, body))
+	ssa.WriteVariable(x, body, sum)
+	ssa.AddEdge(body, header)
+	ssa.SealBlock(header)
+
+	ssa.AddEdge(header, exit)
+	ssa.SealBlock(exit)
+
+	phis := Phis(header)
+	if len(phis) != 1 {
+		t.Fatalf("Expected one phi in the loop header but there are %d", len(phis))
+	}
+	phi := phis[0]
+	if Incoming(phi, entry) != value.Value(zero) || Incoming(phi, body) != value.Value(sum) {
+		t.Errorf("Expected x's phi to merge 0 from before the loop and the sum from the loop body")
+	}
+	if sum.X != value.Value(phi) || sum.Y != value.Value(a) {
+		t.Errorf("Expected the sum to use x's phi and, with y's phi removed, the parameter")
+	}
+	if ssa.ReadVariable(x, exit) != value.Value(phi) || ssa.ReadVariable(y, exit) != value.Value(a) {
+		t.Errorf("Expected x to be its phi and y the parameter after the loop")
+	}
+}
+
+func TestAddressTaken(t *testing.T) {
+	nodes, symbols := Parse(t, `
+type Point struct {
+	pub mut i32 X, Y
+}
+
+fn f() -> i32 {
+	mut i32 x = 1
+	mut Point q
+	mut i32 y = 2
+	const i32* p = & x
+	const i32* r = & q.Y
+	return *p + y
+}
+`)
+	taken := codegen.AddressTaken(&nodes[1].(*ast.FuncDecl).Body)
+	for _, name := range []string{"x", "q"} {
+		if !taken[symbols.IDs[name]] {
+			t.Errorf("Expected the address of '%s' to be taken", name)
+		}
+	}
+	for _, name := range []string{"y", "p", "r"} {
+		if taken[symbols.IDs[name]] {
+			t.Errorf("Expected the address of '%s' not to be taken", name)
+		}
+	}
+}
+
+func TestAssignReusesAlloca(t *testing.T) {
+	nodes, _ := Parse(t, "fn f() -> i32 {\n\tmut i32 x = 1\n\tx = 2\n\tx = x + 3\n\treturn x\n}\n")
+	var gen codegen.IRGenerator
+	gen.GenerateIR(nodes)
+
+	allocas, stores := 0, 0
+	for _, inst := range gen.Module.Funcs[0].Blocks[0].Insts {
+		switch inst.(type) {
+		case *ir.InstAlloca:
+			allocas++
+		case *ir.InstStore:
+			stores++
+		}
+	}
+	if allocas != 1 || stores != 3 {
+		t.Errorf("Expected one alloca stored to 3 times but got %d allocas and %d stores", allocas, stores)
+	}
+}
+
+// '&' works with and without SSA, a constant whose address is taken gets an alloca too
+func TestAddressOfBothModes(t *testing.T) {
+	src := "fn f() -> i32 {\n\tmut i32 x = 1\n\tconst i32 c = 2\n\tconst i32* p = & x\n\tconst i32* q = & c\n\treturn *p + *q\n}\n"
+	for _, ssa := range []bool{false, true} {
+		nodes, _ := Parse(t, src)
+		var gen codegen.IRGenerator
+		gen.SSA = ssa
+		gen.GenerateIR(nodes)
+
+		allocas := 0
+		for _, inst := range gen.Module.Funcs[0].Blocks[0].Insts {
+			if _, ok := inst.(*ir.InstAlloca); ok {
+				allocas++
+			}
+		}
+		// Without SSA p and q get one as well
+		expected := 2
+		if !ssa {
+			expected = 4
+		}
+		if allocas != expected {
+			t.Errorf("Expected %d allocas but got %d (ssa: %v)", expected, allocas, ssa)
+		}
+	}
+}
+
+func SameConstant(a, b value.Value) bool {
+	switch a := a.(type) {
+	case *constant.Int:
+		b, ok := b.(*constant.Int)
+		return ok && a.Typ.Equal(b.Typ) && a.X.Cmp(b.X) == 0
+	case *constant.Float:
+		b, ok := b.(*constant.Float)
+		return ok && a.Typ.Equal(b.Typ) && a.X.Cmp(b.X) == 0
+	}
+	return a == nil && b == nil
+}
+
+func TestFoldBinary(t *testing.T) {
+	i8 := func(x int64) *constant.Int { return constant.NewInt(types.I8, x) }
+	i32 := func(x int64) *constant.Int { return constant.NewInt(types.I32, x) }
+	f32 := func(x float32) *constant.Float { return constant.NewFloat(types.Float, float64(x)) }
+	tests := []struct {
+		Name     string
+		Op       ast.TokenType
+		X, Y     value.Value
+		Unsigned bool
+		Want     value.Value // nil if it shouldn't be folded
+		Err      bool
+	}{
+		{"i8 wraps", ast.TokenTypePlus, i8(127), i8(1), false, i8(-128), false},
+		{"u8 wraps", ast.TokenTypePlus, i8(-1), i8(1), true, i8(0), false}, // 255 + 1
+		{"i8 multiply wraps", ast.TokenTypeAsterisk, i8(16), i8(16), false, i8(0), false},
+		{"i8 min / -1 wraps", ast.TokenTypeSlash, i8(-128), i8(-1), false, i8(-128), false},
+		{"signed division truncates", ast.TokenTypeSlash, i8(-7), i8(2), false, i8(-3), false},
+		{"unsigned division", ast.TokenTypeSlash, i8(-56), i8(3), true, i8(66), false}, // 200 / 3
+		{"signed comparison", ast.TokenTypeCompareGt, i8(-56), i8(100), false, constant.False, false},
+		{"unsigned comparison", ast.TokenTypeCompareGt, i8(-56), i8(100), true, constant.True, false},                     // 200 > 100
+		{"unsigned comparison of wrapped operands", ast.TokenTypeCompareLt, i32(-1), i32(0), true, constant.False, false}, // 4294967295 < 0
+		{"integer division by zero", ast.TokenTypeSlash, i32(1), i32(0), false, nil, true},
+		{"&& of integers", ast.TokenTypeAnd, i32(2), i32(0), false, constant.False, false},
+		{"|| of integers", ast.TokenTypeOr, i32(2), i32(0), false, constant.True, false},
+		{"mismatched types", ast.TokenTypePlus, i8(1), i32(1), false, nil, false},
+		{"f32 rounds", ast.TokenTypePlus, f32(16777216), f32(1), false, f32(16777216), false},
+		{"f32 rounds division", ast.TokenTypeSlash, f32(1), f32(3), false, f32(1.0 / 3), false},
+		{"float division by zero", ast.TokenTypeSlash, f32(1), f32(0), false, nil, false},
+		{"float comparison", ast.TokenTypeCompareLtEq, f32(1), f32(1), false, constant.True, false},
+	}
+
+	for _, test := range tests {
+		folded, ok, err := codegen.FoldBinary(test.Op, test.X, test.Y, test.Unsigned)
+		if (err != nil) != test.Err {
+			t.Errorf("%s: expected error %v but got %v", test.Name, test.Err, err)
+			continue
+		}
+		if ok != (test.Want != nil) || ok && !SameConstant(folded, test.Want) {
+			t.Errorf("%s: expected %v but got %v (folded: %v)", test.Name, test.Want, folded, ok)
+		}
+	}
+}
+
+// '5 < u' with u of a named unsigned type compares unsigned, even though the literal comes first and is signed
+func TestUnsignedNamedType(t *testing.T) {
+	nodes, symbols := Parse(t, "type Size u32\n\nfn f() -> Size {\n\tmut Size u = 5\n\treturn u\n}\n")
+	var gen codegen.IRGenerator
+	gen.GenerateIR(nodes)
+
+	five := &ast.NumberLitExpr{Value: "5", Type: &ast.PrimitiveTypeExpr{PrimitiveType: ast.TokenTypeI32}}
+	u := &ast.VarRefExpr{Name: "u", Sym: symbols.IDs["u"]}
+	if !gen.IsUnsigned(&ast.BinaryExpr{X: five, Op: ast.TokenTypeCompareLt, Y: u}) {
+		t.Errorf("Expected '5 < u' to be unsigned")
+	}
+	if gen.IsUnsigned(five) {
+		t.Errorf("Expected an i32 literal on its own to be signed")
+	}
+}
+
+func TestFoldUnary(t *testing.T) {
+	tests := []struct {
+		Name string
+		Op   ast.TokenType
+		X    value.Value
+		Want value.Value
+	}{
+		{"negate", ast.TokenTypeMinus, constant.NewInt(types.I32, 5), constant.NewInt(types.I32, -5)},
+		{"negate i8 min wraps", ast.TokenTypeMinus, constant.NewInt(types.I8, -128), constant.NewInt(types.I8, -128)},
+		{"negate f32", ast.TokenTypeMinus, constant.NewFloat(types.Float, 0.5), constant.NewFloat(types.Float, -0.5)},
+		{"dereference isn't folded", ast.TokenTypeAsterisk, constant.NewInt(types.I32, 5), nil},
+	}
+	for _, test := range tests {
+		folded, ok := codegen.FoldUnary(test.Op, test.X)
+		if ok != (test.Want != nil) || ok && !SameConstant(folded, test.Want) {
+			t.Errorf("%s: expected %v but got %v (folded: %v)", test.Name, test.Want, folded, ok)
+		}
+	}
+}
+
+// '&&' on values only known at run time gives an i1 like folding it does
+func TestLogicalOpsGiveBool(t *testing.T) {
+	nodes, _ := Parse(t, "fn f() -> bool {\n\tmut i32 a = 2\n\tmut i32 b = 0\n\tconst bool c = a && b\n\tconst bool d = c || c\n\treturn d\n}\n")
+	var gen codegen.IRGenerator
+	gen.GenerateIR(nodes)
+
+	cmps := 0
+	for _, inst := range gen.Module.Funcs[0].Blocks[0].Insts {
+		if _, ok := inst.(*ir.InstICmp); ok {
+			cmps++
+		}
+	}
+	if cmps != 2 {
+		t.Errorf("Expected the 2 i32 operands to be compared with 0 but got %d compares", cmps)
+	}
+}
+
+func TestVTableNeedsWholeInterface(t *testing.T) {
+	src := "type Animal interface {\n\tHello() -> i32\n\tBye() -> i32\n}\n\n" +
+		"type Cat struct {\n\tmut i32 Age\n}\n\ntype Dog struct {\n\tmut i32 Age\n}\n\n" +
+		"fn (cat Cat*) Hello() -> i32 {\n\treturn 0\n}\n\n" +
+		"fn (dog Dog*) Hello() -> i32 {\n\treturn 1\n}\n\n" +
+		"fn (dog Dog*) Bye() -> i32 {\n\treturn 2\n}\n"
+	nodes, symbols := Parse(t, src)
+	var gen codegen.IRGenerator
+	gen.GenerateIR(nodes)
+
+	animal, cat, dog := symbols.IDs["Animal"], symbols.IDs["Cat"], symbols.IDs["Dog"]
+	if gen.Implements(cat, animal) {
+		t.Errorf("Expected Cat, which has no Bye, not to implement Animal")
+	}
+	if !gen.Implements(dog, animal) {
+		t.Errorf("Expected Dog to implement Animal")
+	}
+
+	var names []string
+	for _, field := range gen.InterfaceVTables[animal].Fields {
+		names = append(names, field.(*ir.Func).GlobalName)
+	}
+	if expected := []string{"Dog_Hello", "Dog_Bye"}; !reflect.DeepEqual(names, expected) {
+		t.Errorf("Expected Animal's vtable to be %v but got %v", expected, names)
+	}
+}
+
+func TestTypeInterner(t *testing.T) {
+	nodes, symbols := Parse(t, "type Foo i32\n\nfn f() -> i32 {\n\tconst Foo x = 1\n\treturn 0\n}\n")
+	var gen codegen.IRGenerator
+	gen.GenerateIR(nodes)
+	i32 := func() ast.Expr { return &ast.PrimitiveTypeExpr{PrimitiveType: ast.TokenTypeI32} }
+	ptr := func() ast.Expr { return &ast.PointerTypeExpr{PointerToType: i32()} }
+
+	lowered := len(gen.Types.LLVM)
+	a, errA := gen.TypeID(ptr())
+	b, errB := gen.TypeID(ptr())
+	if errA != nil || errB != nil || a != b {
+		t.Errorf("Expected every 'i32*' to have the same TypeID")
+	}
+	if len(gen.Types.LLVM) != lowered+1 {
+		t.Errorf("Expected 'i32*' to be lowered once but %d types were added", len(gen.Types.LLVM)-lowered)
+	}
+
+	ty, _ := gen.Type(i32())
+	if ty != gen.Module.Funcs[0].Sig.RetType {
+		t.Errorf("Expected every 'i32' to be the same LLVM type")
+	}
+	if ty.Name() != "" {
+		t.Errorf("Expected 'type Foo i32' not to rename the shared i32 but it's called '%s'", ty.Name())
+	}
+	foo, err := gen.Type(&ast.IdentifierExpr{Name: "Foo", Sym: symbols.IDs["Foo"]})
+	if err != nil || foo == ty || foo.Name() != "Foo" {
+		t.Errorf("Expected Foo to be an LLVM type of its own")
+	}
+}
+
+// Functions with locals, assignments, a method and a local declared with a struct type written out in place
+func GenerateSource(fns int) string {
+	var src strings.Builder
+	src.WriteString("type Shape interface {\n\tArea() -> i32\n}\n\ntype Square struct {\n\tpub mut i32 Side\n}\n\n")
+	src.WriteString("fn (s Square*) Area() -> i32 {\n\treturn 0\n}\n\n")
+	for i := 0; i < fns; i++ {
+		fmt.Fprintf(&src, "fn fun%d() -> i32 {\n\tconst i32 x = %d * 2 + 1\n\tmut i32 y = x\n\ty = y + x\n\tmut struct {\n\t\tmut i32 X\n\t} s\n\treturn y\n}\n\n", i, i)
+	}
+	return src.String()
+}
+
+func TestParallelMatchesSequential(t *testing.T) {
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	for _, ssa := range []bool{false, true} {
+		nodes, _ := Parse(t, GenerateSource(500))
+		var sequential, parallel codegen.IRGenerator
+		sequential.SSA = ssa
+		sequential.GenerateIR(nodes)
+		nodes, _ = Parse(t, GenerateSource(500))
+		parallel.SSA = ssa
+		parallel.GenerateIRParallel(nodes)
+
+		if !reflect.DeepEqual(sequential.Module, parallel.Module) {
+			t.Errorf("Expected generating bodies in parallel to give the same module as generating them in order (ssa: %v)", ssa)
+		}
+	}
+}
@@ -0,0 +1,151 @@
+package codegen
+
+import (
+	"fmt"
+	"math/big"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/llir/llvm/ir/constant"
+	"github.com/llir/llvm/ir/types"
+	"github.com/llir/llvm/ir/value"
+)
+
+/*
+ * Operators applied to constants are worked out while generating IR, so 'const i32 x = 4 * 1024 + 16' is just the constant 4112
+ * Integers wrap at the width of their type the same way the instructions would at run time
+ * Integer constants always hold the signed value of their bits (255 as an i8 is -1), unsigned tells how to read them back
+ * '&&' and '||' treat any integer that isn't 0 as true and give an i1, the same as BinaryExpr's instructions
+ */
+
+// The value of c's bits as a signed or unsigned integer
+func intValue(c *constant.Int, unsigned bool) *big.Int {
+	x := new(big.Int).Set(c.X)
+	if unsigned && x.Sign() < 0 {
+		x.Add(x, new(big.Int).Lsh(big.NewInt(1), uint(c.Typ.BitSize)))
+	}
+	return x
+}
+
+// The constant of type ty with the low bits of x
+func wrapInt(ty *types.IntType, x *big.Int) *constant.Int {
+	mod := new(big.Int).Lsh(big.NewInt(1), uint(ty.BitSize))
+	x = new(big.Int).Mod(x, mod)
+	if ty.BitSize > 1 && x.Cmp(new(big.Int).Rsh(mod, 1)) >= 0 {
+		x.Sub(x, mod)
+	}
+	return &constant.Int{Typ: ty, X: x}
+}
+
+// The constant of type ty closest to x, f32s are rounded to 32 bits
+func floatConst(ty *types.FloatType, x float64) *constant.Float {
+	if ty.Kind == types.FloatKindFloat {
+		x = float64(float32(x))
+	}
+	return constant.NewFloat(ty, x)
+}
+
+// What op gives comparing two values, cmp is -1, 0 or 1 like big.Int.Cmp
+func compare(op ast.TokenType, cmp int) (bool, bool) {
+	switch op {
+	case ast.TokenTypeCompareLt:
+		return cmp < 0, true
+	case ast.TokenTypeCompareGt:
+		return cmp > 0, true
+	case ast.TokenTypeCompareLtEq:
+		return cmp <= 0, true
+	case ast.TokenTypeCompareGtEq:
+		return cmp >= 0, true
+	case ast.TokenTypeCompareEq:
+		return cmp == 0, true
+	case ast.TokenTypeCompareNe:
+		return cmp != 0, true
+	}
+	return false, false
+}
+
+/*
+ * x op y if they're both constants of the same type, ok is false if it can't be worked out at compile time
+ * unsigned is whether integer operands are unsigned, which changes division and comparisons
+ */
+func FoldBinary(op ast.TokenType, x, y value.Value, unsigned bool) (folded value.Value, ok bool, err error) {
+	if !x.Type().Equal(y.Type()) {
+		return nil, false, nil
+	}
+
+	switch x := x.(type) {
+	case *constant.Int:
+		y, isInt := y.(*constant.Int)
+		if !isInt {
+			return nil, false, nil
+		}
+		a, b := intValue(x, unsigned), intValue(y, unsigned)
+		switch op {
+		case ast.TokenTypePlus:
+			return wrapInt(x.Typ, a.Add(a, b)), true, nil
+		case ast.TokenTypeMinus:
+			return wrapInt(x.Typ, a.Sub(a, b)), true, nil
+		case ast.TokenTypeAsterisk:
+			return wrapInt(x.Typ, a.Mul(a, b)), true, nil
+		case ast.TokenTypeSlash:
+			if b.Sign() == 0 {
+				return nil, false, fmt.Errorf("division by zero in constant expression")
+			}
+			return wrapInt(x.Typ, a.Quo(a, b)), true, nil // Quo truncates towards zero, like sdiv
+		case ast.TokenTypeAnd:
+			return constant.NewBool(a.Sign() != 0 && b.Sign() != 0), true, nil
+		case ast.TokenTypeOr:
+			return constant.NewBool(a.Sign() != 0 || b.Sign() != 0), true, nil
+		}
+		if result, isCompare := compare(op, a.Cmp(b)); isCompare {
+			return constant.NewBool(result), true, nil
+		}
+
+	case *constant.Float:
+		y, isFloat := y.(*constant.Float)
+		if !isFloat {
+			return nil, false, nil
+		}
+		a, _ := x.X.Float64()
+		b, _ := y.X.Float64()
+		switch op {
+		case ast.TokenTypePlus:
+			return floatConst(x.Typ, a+b), true, nil
+		case ast.TokenTypeMinus:
+			return floatConst(x.Typ, a-b), true, nil
+		case ast.TokenTypeAsterisk:
+			return floatConst(x.Typ, a*b), true, nil
+		case ast.TokenTypeSlash:
+			if b == 0 {
+				return nil, false, nil // Infinity or NaN, left to run time
+			}
+			return floatConst(x.Typ, a/b), true, nil
+		}
+		cmp := 0
+		if a < b {
+			cmp = -1
+		} else if a > b {
+			cmp = 1
+		} else if a != b {
+			return nil, false, nil // NaN
+		}
+		if result, isCompare := compare(op, cmp); isCompare {
+			return constant.NewBool(result), true, nil
+		}
+	}
+	return nil, false, nil
+}
+
+// op x if x is a constant, ok is false if it can't be worked out at compile time
+func FoldUnary(op ast.TokenType, x value.Value) (folded value.Value, ok bool) {
+	if op != ast.TokenTypeMinus {
+		return nil, false
+	}
+	switch x := x.(type) {
+	case *constant.Int:
+		return wrapInt(x.Typ, new(big.Int).Neg(x.X)), true
+	case *constant.Float:
+		f, _ := x.X.Float64()
+		return floatConst(x.Typ, -f), true
+	}
+	return nil, false
+}
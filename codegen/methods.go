@@ -0,0 +1,179 @@
+package codegen
+
+import (
+	"encoding/binary"
+	"hash/fnv"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/utils"
+	"github.com/llir/llvm/ir"
+)
+
+// A method of an interface, Slot is its index in the interface and in the interface's vtable
+type MethodSlot struct {
+	Interface ast.Symbol
+	Slot      int
+}
+
+// The name and types of a method, which is all that has to match for a function to be one of an interface's methods
+type MethodSig struct {
+	Sym    ast.Symbol
+	Return TypeID
+	Params []TypeID
+}
+
+func (sig *MethodSig) Hash() uint64 {
+	hash := fnv.New64a()
+	var buf [4]byte
+	word := func(x uint32) {
+		binary.LittleEndian.PutUint32(buf[:], x)
+		hash.Write(buf[:])
+	}
+	word(uint32(sig.Sym))
+	word(uint32(sig.Return))
+	for _, param := range sig.Params {
+		word(uint32(param))
+	}
+	return hash.Sum64()
+}
+
+func (sig *MethodSig) Equal(other *MethodSig) bool {
+	if sig.Sym != other.Sym || sig.Return != other.Return || len(sig.Params) != len(other.Params) {
+		return false
+	}
+	for i := range sig.Params {
+		if sig.Params[i] != other.Params[i] {
+			return false
+		}
+	}
+	return true
+}
+
+type indexedMethod struct {
+	Sig  MethodSig
+	Slot MethodSlot
+}
+
+// The methods a receiver type has that interfaces ask for
+type MethodTable struct {
+	Funcs   map[MethodSlot]*ir.Func
+	Covered map[ast.Symbol]int // How many of each interface's methods the type has
+}
+
+/*
+ * Every interface method by the hash of its signature, so finding which interfaces a function is a method of is one map lookup
+ * and a per receiver type table of the methods it has, so whether it implements an interface is a count compare
+ * Only touched while declaring functions, which GenerateIRParallel also does in order on one goroutine
+ */
+type MethodIndex struct {
+	Methods map[uint64][]indexedMethod
+	Tables  map[ast.Symbol]*MethodTable // By the name of the receiver type
+	Pending []ast.Symbol                // Interfaces whose methods haven't been indexed yet
+}
+
+func (index *MethodIndex) Init() {
+	index.Methods = make(map[uint64][]indexedMethod)
+	index.Tables = make(map[ast.Symbol]*MethodTable)
+	index.Pending = nil
+}
+
+// The signature of a method or function, its receiver isn't part of it
+func (gen *IRGenerator) MethodSig(sym ast.Symbol, ret ast.Expr, params []ast.Param) MethodSig {
+	sig := MethodSig{Sym: sym, Params: make([]TypeID, len(params))}
+	var err error
+	if sig.Return, err = gen.TypeID(ret); err != nil {
+		utils.FatalError("could not codegen method return type")
+	}
+	for i, param := range params {
+		if sig.Params[i], err = gen.TypeID(param.Type); err != nil {
+			utils.FatalError("could not codegen method param type")
+		}
+	}
+	return sig
+}
+
+/*
+ * Add the methods of every interface declared since the last call to the index
+ * Done when a function needs them rather than when the interface is declared, its methods can use types declared after it
+ */
+func (gen *IRGenerator) IndexInterfaces() {
+	for _, interfaceSym := range gen.MethodIndex.Pending {
+		for slot, method := range gen.InterfaceTypeExprs[interfaceSym].Methods.Methods {
+			sig := gen.MethodSig(method.Sym, method.Return, method.Params.Params)
+			hash := sig.Hash()
+			gen.MethodIndex.Methods[hash] = append(gen.MethodIndex.Methods[hash], indexedMethod{Sig: sig, Slot: MethodSlot{Interface: interfaceSym, Slot: slot}})
+		}
+	}
+	gen.MethodIndex.Pending = gen.MethodIndex.Pending[:0]
+}
+
+// The interface methods fnDecl is, in the order the interfaces were declared
+func (gen *IRGenerator) MethodSlots(fnDecl *ast.FuncDecl) []MethodSlot {
+	gen.IndexInterfaces()
+	sig := gen.MethodSig(fnDecl.Sym, fnDecl.FuncType.Return, fnDecl.FuncType.Params.Params)
+	var slots []MethodSlot
+	for _, method := range gen.MethodIndex.Methods[sig.Hash()] {
+		if method.Sig.Equal(&sig) {
+			slots = append(slots, method.Slot)
+		}
+	}
+	return slots
+}
+
+/*
+ * Record that fn is the receiver type's method for each of slots
+ * An interface's vtable is filled with the methods of the first type that has all of them, a type that only has some never goes in it
+ */
+func (gen *IRGenerator) AddMethod(receiver ast.Symbol, fn *ir.Func, slots []MethodSlot) {
+	table := gen.MethodIndex.Tables[receiver]
+	if table == nil {
+		table = &MethodTable{Funcs: make(map[MethodSlot]*ir.Func), Covered: make(map[ast.Symbol]int)}
+		gen.MethodIndex.Tables[receiver] = table
+	}
+
+	for _, slot := range slots {
+		if _, ok := table.Funcs[slot]; ok {
+			continue
+		}
+		table.Funcs[slot] = fn
+		table.Covered[slot.Interface]++
+		if gen.Implements(receiver, slot.Interface) {
+			gen.FillVTable(slot.Interface, table)
+		}
+	}
+}
+
+// Put table's methods in the vtable of the interface named interfaceSym, unless another type's are already there
+func (gen *IRGenerator) FillVTable(interfaceSym ast.Symbol, table *MethodTable) {
+	vTableType := gen.InterfaceVTableTypes[interfaceSym]
+	vTableData := gen.InterfaceVTables[interfaceSym]
+	if len(vTableData.Fields) > 0 {
+		return
+	}
+	for slot := range gen.InterfaceTypeExprs[interfaceSym].Methods.Methods {
+		fn := table.Funcs[MethodSlot{Interface: interfaceSym, Slot: slot}]
+		vTableType.Fields = append(vTableType.Fields, fn.Type())
+		vTableData.Fields = append(vTableData.Fields, fn)
+	}
+}
+
+// Whether the type named receiver has every method of the interface named interfaceSym
+func (gen *IRGenerator) Implements(receiver ast.Symbol, interfaceSym ast.Symbol) bool {
+	table := gen.MethodIndex.Tables[receiver]
+	interfaceTy := gen.InterfaceTypeExprs[interfaceSym]
+	return table != nil && interfaceTy != nil && table.Covered[interfaceSym] == len(interfaceTy.Methods.Methods)
+}
+
+// The Symbol of the type a receiver of type ty is, or a pointer to
+func ReceiverSym(ty ast.Expr) (ast.Symbol, bool) {
+	for {
+		switch t := ty.(type) {
+		case *ast.PointerTypeExpr:
+			ty = t.PointerToType
+		case *ast.IdentifierExpr:
+			return t.Sym, true
+		default:
+			return 0, false
+		}
+	}
+}
@@ -0,0 +1,82 @@
+package codegen
+
+import (
+	"fmt"
+	"runtime"
+	"sync"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/utils"
+	"github.com/llir/llvm/ir"
+)
+
+// A function whose body still has to be generated
+type funcBody struct {
+	Decl *ast.FuncDecl
+	Fn   *ir.Func
+}
+
+/*
+ * Generate IR for nodes with function bodies generated on several goroutines, Module comes out the same as GenerateIR's
+ *
+ * Types, function signatures and vtables are generated first, in order, so every function exists before any body refers to it
+ * Bodies are then generated on a pool of goroutines, each with its own copy of the generator for CurBB, the locals and so on
+ * A body only ever adds blocks to its own function, which already has its place in Module, so nothing needs merging afterwards
+ * Locals' types are lowered in the first pass too, a struct or interface type written out in a body adds typedefs and vtables
+ * so the goroutines only ever look types up
+ */
+func (gen *IRGenerator) GenerateIRParallel(nodes []ast.Node) {
+	gen.Init()
+	gen.Module = ir.NewModule()
+
+	var bodies []funcBody
+	for _, node := range nodes {
+		fnDecl, ok := node.(*ast.FuncDecl)
+		if !ok {
+			gen.Node(node)
+			continue
+		}
+		// Lazy bodies are parsed with the parser's arena, which isn't safe to use from more than one goroutine
+		if err := fnDecl.ExpandBody(); err != nil {
+			utils.FatalError(fmt.Sprintf("could not parse body of '%s':\n%s", fnDecl.Name, err.Error()))
+		}
+		fn := gen.DeclareFunc(fnDecl)
+		gen.LowerLocalTypes(&fnDecl.Body)
+		bodies = append(bodies, funcBody{Decl: fnDecl, Fn: fn})
+	}
+
+	workers := runtime.GOMAXPROCS(0)
+	if workers > len(bodies) {
+		workers = len(bodies)
+	}
+	next := make(chan *funcBody, len(bodies))
+	for i := range bodies {
+		next <- &bodies[i]
+	}
+	close(next)
+
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			worker := *gen
+			worker.Locals = SSABuilder{}
+			for body := range next {
+				worker.FuncBody(body.Decl, body.Fn)
+			}
+		}()
+	}
+	wg.Wait()
+}
+
+// Lower the types body's locals are declared with, in the same order generating the body would
+func (gen *IRGenerator) LowerLocalTypes(body *ast.BlockStmt) {
+	for _, stmt := range body.List {
+		if varDecl, ok := stmt.(*ast.VarDecl); ok {
+			if _, err := gen.Type(varDecl.Type); err != nil {
+				utils.FatalError(fmt.Sprintf("could not codegen type: %s", err.Error()))
+			}
+		}
+	}
+}
@@ -0,0 +1,277 @@
+package codegen
+
+import (
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/llir/llvm/ir"
+	"github.com/llir/llvm/ir/constant"
+	"github.com/llir/llvm/ir/types"
+	"github.com/llir/llvm/ir/value"
+)
+
+// A local variable of the function being generated
+type SSAVar struct {
+	Type types.Type
+	Mut  bool
+	Slot *ir.InstAlloca // Where it lives if its address is taken, nil if it only lives in SSA values
+}
+
+/*
+ * Builds SSA form for a function's locals while it's being generated, following Braun et al.,
+ * "Simple and Efficient Construction of Static Single Assignment Form"
+ *
+ * A local's value in a block is the last one written to it there, or if there isn't one, a phi of its values in the block's predecessors
+ * A block's predecessors are only all known once it's sealed, phis made before then are filled in by SealBlock
+ * Phis that turn out to only ever have one value are removed and replaced by that value
+ */
+type SSABuilder struct {
+	Fn         *ir.Func
+	Vars       map[ast.Symbol]*SSAVar
+	Defs       map[*ir.Block]map[ast.Symbol]value.Value
+	Preds      map[*ir.Block][]*ir.Block
+	Sealed     map[*ir.Block]bool
+	Incomplete map[*ir.Block]map[ast.Symbol]*ir.InstPhi
+	PhiBlocks  map[*ir.InstPhi]*ir.Block
+	Allocas    int // How many allocas have been put at the start of the entry block
+}
+
+func (ssa *SSABuilder) Init(fn *ir.Func) {
+	ssa.Fn = fn
+	ssa.Vars = make(map[ast.Symbol]*SSAVar)
+	ssa.Defs = make(map[*ir.Block]map[ast.Symbol]value.Value)
+	ssa.Preds = make(map[*ir.Block][]*ir.Block)
+	ssa.Sealed = make(map[*ir.Block]bool)
+	ssa.Incomplete = make(map[*ir.Block]map[ast.Symbol]*ir.InstPhi)
+	ssa.PhiBlocks = make(map[*ir.InstPhi]*ir.Block)
+	ssa.Allocas = 0
+}
+
+/*
+ * Add a local, escapes is whether its address is taken
+ * Locals whose address is taken get an alloca at the start of the entry block, so it's only made once however often its declaration runs
+ */
+func (ssa *SSABuilder) Declare(sym ast.Symbol, ty types.Type, mut bool, escapes bool) *SSAVar {
+	v := &SSAVar{Type: ty, Mut: mut}
+	if escapes {
+		v.Slot = ir.NewAlloca(ty)
+		entry := ssa.Fn.Blocks[0]
+		entry.Insts = append(entry.Insts, nil)
+		copy(entry.Insts[ssa.Allocas+1:], entry.Insts[ssa.Allocas:])
+		entry.Insts[ssa.Allocas] = v.Slot
+		ssa.Allocas++
+	}
+	ssa.Vars[sym] = v
+	return v
+}
+
+// Record that from branches to to, every predecessor of a block has to be added before it's sealed
+func (ssa *SSABuilder) AddEdge(from, to *ir.Block) {
+	ssa.Preds[to] = append(ssa.Preds[to], from)
+}
+
+func (ssa *SSABuilder) WriteVariable(sym ast.Symbol, block *ir.Block, val value.Value) {
+	defs := ssa.Defs[block]
+	if defs == nil {
+		defs = make(map[ast.Symbol]value.Value)
+		ssa.Defs[block] = defs
+	}
+	defs[sym] = val
+}
+
+func (ssa *SSABuilder) ReadVariable(sym ast.Symbol, block *ir.Block) value.Value {
+	if val, ok := ssa.Defs[block][sym]; ok {
+		return val
+	}
+	return ssa.readVariableRecursive(sym, block)
+}
+
+func (ssa *SSABuilder) readVariableRecursive(sym ast.Symbol, block *ir.Block) value.Value {
+	var val value.Value
+	preds := ssa.Preds[block]
+	if !ssa.Sealed[block] {
+		// More predecessors might still be added, so the phi is filled in when the block is sealed
+		phi := ssa.newPhi(sym, block)
+		incomplete := ssa.Incomplete[block]
+		if incomplete == nil {
+			incomplete = make(map[ast.Symbol]*ir.InstPhi)
+			ssa.Incomplete[block] = incomplete
+		}
+		incomplete[sym] = phi
+		val = phi
+	} else if len(preds) == 0 {
+		// Read before anything was written to it
+		val = constant.NewUndef(ssa.Vars[sym].Type)
+	} else if len(preds) == 1 {
+		val = ssa.ReadVariable(sym, preds[0])
+	} else {
+		// Written before the phi's operands are read, so a loop back to this block finds the phi instead of recursing forever
+		phi := ssa.newPhi(sym, block)
+		ssa.WriteVariable(sym, block, phi)
+		val = ssa.addPhiOperands(sym, phi)
+	}
+	ssa.WriteVariable(sym, block, val)
+	return val
+}
+
+// A phi with no operands yet at the start of block, after any phis already there
+func (ssa *SSABuilder) newPhi(sym ast.Symbol, block *ir.Block) *ir.InstPhi {
+	phi := ir.NewPhi()
+	phi.Typ = ssa.Vars[sym].Type
+	i := 0
+	for i < len(block.Insts) {
+		if _, ok := block.Insts[i].(*ir.InstPhi); !ok {
+			break
+		}
+		i++
+	}
+	block.Insts = append(block.Insts, nil)
+	copy(block.Insts[i+1:], block.Insts[i:])
+	block.Insts[i] = phi
+	ssa.PhiBlocks[phi] = block
+	return phi
+}
+
+func (ssa *SSABuilder) addPhiOperands(sym ast.Symbol, phi *ir.InstPhi) value.Value {
+	for _, pred := range ssa.Preds[ssa.PhiBlocks[phi]] {
+		phi.Incs = append(phi.Incs, ir.NewIncoming(ssa.ReadVariable(sym, pred), pred))
+	}
+	return ssa.tryRemoveTrivialPhi(phi)
+}
+
+// Replace phi with its only operand if it has one other than itself
+func (ssa *SSABuilder) tryRemoveTrivialPhi(phi *ir.InstPhi) value.Value {
+	var same value.Value
+	for _, inc := range phi.Incs {
+		if inc.X == same || inc.X == value.Value(phi) {
+			continue
+		}
+		if same != nil {
+			return phi // Merges at least two values, so it isn't trivial
+		}
+		same = inc.X
+	}
+	if same == nil {
+		same = constant.NewUndef(phi.Typ) // Unreachable or in the entry block
+	}
+
+	// Phis that used this one could have become trivial too
+	var users []*ir.InstPhi
+	block := ssa.PhiBlocks[phi]
+	for _, b := range ssa.Fn.Blocks {
+		for _, inst := range b.Insts {
+			if user, ok := inst.(*ir.InstPhi); ok && user != phi {
+				for _, inc := range user.Incs {
+					if inc.X == value.Value(phi) {
+						users = append(users, user)
+						break
+					}
+				}
+			}
+		}
+	}
+	ssa.replaceUses(phi, same)
+	for i, inst := range block.Insts {
+		if inst == ir.Instruction(phi) {
+			block.Insts = append(block.Insts[:i], block.Insts[i+1:]...)
+			break
+		}
+	}
+	delete(ssa.PhiBlocks, phi)
+
+	for _, user := range users {
+		if _, ok := ssa.PhiBlocks[user]; ok {
+			ssa.tryRemoveTrivialPhi(user)
+		}
+	}
+	return same
+}
+
+// Instructions and terminators in llir list their operands as pointers, so uses can be swapped in place
+type operandsUser interface {
+	Operands() []*value.Value
+}
+
+// Make everything that used old use new instead, the function's instructions and the values locals have in each block
+func (ssa *SSABuilder) replaceUses(old, new value.Value) {
+	replace := func(user interface{}) {
+		if user, ok := user.(operandsUser); ok {
+			for _, operand := range user.Operands() {
+				if *operand == old {
+					*operand = new
+				}
+			}
+		}
+	}
+	for _, block := range ssa.Fn.Blocks {
+		for _, inst := range block.Insts {
+			replace(inst)
+		}
+		replace(block.Term)
+	}
+	for _, defs := range ssa.Defs {
+		for sym, val := range defs {
+			if val == old {
+				defs[sym] = new
+			}
+		}
+	}
+}
+
+// Call once every predecessor of block has been added with AddEdge
+func (ssa *SSABuilder) SealBlock(block *ir.Block) {
+	for sym, phi := range ssa.Incomplete[block] {
+		ssa.addPhiOperands(sym, phi)
+	}
+	delete(ssa.Incomplete, block)
+	ssa.Sealed[block] = true
+}
+
+/*
+ * The locals in body whose address is taken with '&', '&x.y' takes x's address too
+ * These have to live in memory, every other local can be kept in SSA values
+ */
+func AddressTaken(body *ast.BlockStmt) map[ast.Symbol]bool {
+	taken := make(map[ast.Symbol]bool)
+	var exprs []ast.Expr
+	for _, stmt := range body.List {
+		switch s := stmt.(type) {
+		case *ast.VarDecl:
+			exprs = append(exprs, s.Values...)
+		case *ast.ReturnStmt:
+			exprs = append(exprs, s.Value)
+		case *ast.ExprStmt:
+			exprs = append(exprs, s.X)
+		default:
+			exprs = append(exprs, s) // Expressions used as statements, like 'x = 1'
+		}
+	}
+
+	// Expressions can be millions of terms deep, so they're walked with a stack instead of recursing
+	for len(exprs) > 0 {
+		expr := exprs[len(exprs)-1]
+		exprs = exprs[:len(exprs)-1]
+		switch e := expr.(type) {
+		case *ast.BinaryExpr:
+			exprs = append(exprs, e.X, e.Y)
+		case *ast.CallExpr:
+			exprs = append(exprs, e.Fn)
+			exprs = append(exprs, e.Args...)
+		case *ast.UnaryExpr:
+			exprs = append(exprs, e.X)
+			if e.Op != ast.TokenTypeAmpersand {
+				continue
+			}
+			x := e.X
+			for {
+				if field, ok := x.(*ast.BinaryExpr); ok && field.Op == ast.TokenTypePeriod {
+					x = field.X
+					continue
+				}
+				break
+			}
+			if ref, ok := x.(*ast.VarRefExpr); ok {
+				taken[ref.Sym] = true
+			}
+		}
+	}
+	return taken
+}
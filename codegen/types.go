@@ -0,0 +1,120 @@
+package codegen
+
+import (
+	"fmt"
+	"sync"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/llir/llvm/ir/types"
+)
+
+// The dense ID of an interned pi type, two types are the same exactly when their IDs are
+type TypeID uint32
+
+type typeKind uint8
+
+const (
+	typePrimitive typeKind = iota
+	typePointer
+	typeNamed // A type declared with 'type Name ...', named types are only ever the same as themselves
+	typeDecl  // A struct or interface type, each one written out is its own type
+)
+
+// What makes a type unique, pointers are keyed by what they point to so every 'i32*' is the same
+type typeKey struct {
+	Kind      typeKind
+	Primitive ast.TokenType
+	Elem      TypeID
+	Sym       ast.Symbol
+	Node      ast.Expr
+}
+
+/*
+ * Gives every structurally distinct pi type one TypeID and lowers it to an LLVM type once
+ * Shared by the goroutines of GenerateIRParallel, so the tables are only touched under mu
+ */
+type TypeInterner struct {
+	mu   sync.RWMutex
+	IDs  map[typeKey]TypeID
+	LLVM []types.Type // LLVM[id] is the LLVM type of id
+}
+
+func (interner *TypeInterner) lookup(key typeKey) (TypeID, bool) {
+	interner.mu.RLock()
+	id, ok := interner.IDs[key]
+	interner.mu.RUnlock()
+	return id, ok
+}
+
+// The ID of key, given ty if it doesn't have one yet, if another goroutine got there first its type is kept instead
+func (interner *TypeInterner) add(key typeKey, ty types.Type) TypeID {
+	interner.mu.Lock()
+	defer interner.mu.Unlock()
+	if id, ok := interner.IDs[key]; ok {
+		return id
+	}
+	if interner.IDs == nil {
+		interner.IDs = make(map[typeKey]TypeID)
+	}
+	id := TypeID(len(interner.LLVM))
+	interner.LLVM = append(interner.LLVM, ty)
+	interner.IDs[key] = id
+	return id
+}
+
+func (interner *TypeInterner) Type(id TypeID) types.Type {
+	interner.mu.RLock()
+	defer interner.mu.RUnlock()
+	return interner.LLVM[id]
+}
+
+// Intern the pi type ty, lowering it to an LLVM type the first time it's seen
+func (gen *IRGenerator) TypeID(ty ast.Expr) (TypeID, error) {
+	var key typeKey
+	switch t := ty.(type) {
+	default:
+		return 0, fmt.Errorf("could not convert pi type to llvm type")
+	case *ast.PrimitiveTypeExpr:
+		key = typeKey{Kind: typePrimitive, Primitive: t.PrimitiveType}
+	case *ast.VoidExpr:
+		key = typeKey{Kind: typePrimitive, Primitive: ast.TokenTypeVoid}
+	case *ast.PointerTypeExpr:
+		elem, err := gen.TypeID(t.PointerToType)
+		if err != nil {
+			return 0, fmt.Errorf("could not convert pointer type to llvmm type: %s", err.Error())
+		}
+		key = typeKey{Kind: typePointer, Elem: elem}
+	case *ast.IdentifierExpr:
+		key = typeKey{Kind: typeNamed, Sym: t.Sym}
+	case *ast.StructTypeExpr, *ast.InterfaceTypeExpr:
+		key = typeKey{Kind: typeDecl, Node: t}
+	}
+	if id, ok := gen.Types.lookup(key); ok {
+		return id, nil
+	}
+
+	var llvmTy types.Type
+	var err error
+	switch t := ty.(type) {
+	case *ast.PrimitiveTypeExpr:
+		llvmTy, err = gen.PrimitiveTypeExpr(t)
+	case *ast.VoidExpr:
+		llvmTy, err = gen.VoidExpr(t)
+	case *ast.PointerTypeExpr:
+		llvmTy = types.NewPointer(gen.Types.Type(key.Elem))
+	case *ast.IdentifierExpr:
+		// Not cached until it's declared, it could be used before its declaration has been generated
+		var ok bool
+		if llvmTy, ok = gen.Typedef(t.Sym); !ok {
+			err = fmt.Errorf("could not convert pi type to llvm type")
+		}
+	case *ast.StructTypeExpr:
+		llvmTy, err = gen.StructTypeExpr(t)
+	case *ast.InterfaceTypeExpr:
+		llvmTy, err = gen.InterfaceTypeExpr(t)
+	}
+	if err != nil {
+		return 0, err
+	}
+	return gen.Types.add(key, llvmTy), nil
+}
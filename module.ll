@@ -1,13 +1,13 @@
 %Foo = type i32
 %Animal = type { %Animal_VTable_Type* }
-%Animal_VTable_Type = type {}
+%Animal_VTable_Type = type { i32 (%Dog*)* }
 %Animal = type { %Animal_VTable_Type* }
 %Dog = type { i32, i32*, i32*, i32*, i32, i32 }
 %Dog = type { i32, i32*, i32*, i32*, i32, i32 }
 
-@Animal_VTable_Data = global %Animal_VTable_Type {}
+@Animal_VTable_Data = global %Animal_VTable_Type { i32 (%Dog*)* @Dog_Hello }
 
-define i32 @Hello(%Dog* %dog) {
+define i32 @Dog_Hello(%Dog* %dog) {
 entry:
 	ret i32 0
 }
@@ -19,12 +19,9 @@ entry:
 
 define i32 @main() {
 entry:
-	%0 = alloca %Animal
-	%1 = load %Animal, %Animal* null
-	store %Animal %1, %Animal* %0
-	%2 = load %Animal, %Animal* %0
-	%3 = alloca %Foo
-	store %Foo 0, %Foo* %3
-	%4 = load %Foo, %Foo* %3
+	%0 = load %Animal, %Animal* null
+	%1 = alloca %Animal
+	store %Animal %0, %Animal* %1
+	%2 = load %Animal, %Animal* %1
 	ret i32 0
 }
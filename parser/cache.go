@@ -0,0 +1,96 @@
+package parser
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"io/ioutil"
+	"os"
+	"path/filepath"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+)
+
+// Has to be bumped whenever the parser starts making a different AST for the same source, so ASTs cached before aren't read
+const ASTVersion = "1"
+
+/*
+ * ASTs saved in Dir as encoded FlatASTs, named by a hash of the compiler version and the source they were parsed from
+ * An unchanged file is read back instead of being lexed and parsed again
+ * Entries are never invalidated, a different source or version just hashes to a different file
+ */
+type ASTCache struct {
+	Dir     string
+	Version string
+}
+
+func (cache *ASTCache) Path(src []byte) string {
+	hash := sha256.New()
+	hash.Write([]byte(cache.Version))
+	hash.Write([]byte{0})
+	hash.Write(src)
+	return filepath.Join(cache.Dir, hex.EncodeToString(hash.Sum(nil))+".ast")
+}
+
+/*
+ * Get the AST of src if it's been stored, with its Symbols from symbols and its nodes allocated in arena
+ * Anything wrong with the entry is treated as it not being there
+ */
+func (cache *ASTCache) Load(src []byte, symbols *ast.Interner, arena *ast.Arena) ([]ast.Node, bool) {
+	data, err := ioutil.ReadFile(cache.Path(src))
+	if err != nil {
+		return nil, false
+	}
+	var flat ast.FlatAST
+	if err := flat.UnmarshalBinary(data); err != nil {
+		return nil, false
+	}
+	if err := flat.Reintern(symbols); err != nil {
+		return nil, false
+	}
+	nodes, err := flat.Inflate(arena)
+	if err != nil {
+		return nil, false
+	}
+	return nodes, true
+}
+
+/*
+ * Store the AST parsed from src, only ASTs of files without errors should be stored
+ * lexer is the one src was parsed with, the order it made identifiers in is stored so loading gives the same Symbols parsing did
+ */
+func (cache *ASTCache) Store(src []byte, nodes []ast.Node, lexer *ast.Lexer) error {
+	var flat ast.FlatAST
+	if err := flat.Flatten(nodes); err != nil {
+		return err
+	}
+
+	idents := make([]string, len(lexer.Idents))
+	for i, sym := range lexer.Idents {
+		idents[i] = lexer.Symbols.Name(sym)
+	}
+	flat.SetIdents(idents)
+	data, err := flat.MarshalBinary()
+	if err != nil {
+		return err
+	}
+
+	// Written next to where it goes and renamed, so another compiler reading the cache never sees half of it
+	if err := os.MkdirAll(cache.Dir, 0755); err != nil {
+		return err
+	}
+	file, err := ioutil.TempFile(cache.Dir, "*.tmp")
+	if err != nil {
+		return err
+	}
+	_, err = file.Write(data)
+	if closeErr := file.Close(); err == nil {
+		err = closeErr
+	}
+	if err == nil {
+		err = os.Rename(file.Name(), cache.Path(src))
+	}
+	if err != nil {
+		os.Remove(file.Name())
+	}
+	return err
+}
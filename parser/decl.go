@@ -10,27 +10,30 @@ import (
  * Parse the 'x, y, z' in 'mut i32 x, y, z = 10, 2, 5'
  *
  * @return idents []string ["x", "y", "z"]
+ * @return syms []ast.Symbol the Symbols of idents
  */
-func (p *Parser) ParseIdentList() []string {
+func (p *Parser) ParseIdentList() ([]string, []ast.Symbol) {
 	var idents []string
+	var syms []ast.Symbol
 
 	for p.CurTok.TokenType != ast.TokenTypeComma && p.CurTok.TokenType != ast.TokenTypeEq {
 		p.Expect(ast.TokenTypeIdentifier, "expected identifier following mutable declaration type")
 		idents = append(idents, p.CurTok.Value)
+		syms = append(syms, p.CurTok.Sym)
 		p.EatToken()
 
 		if p.CurTok.TokenType == ast.TokenTypeComma {
 			p.EatToken()
 		} else {
-			return idents
+			return idents, syms
 		}
 	}
 
-	return idents // i don't think this will ever be reached
+	return idents, syms // i don't think this will ever be reached
 }
 
 func (p *Parser) ParseVarDecl() (ast.Decl, error) {
-	var varDecl ast.VarDecl
+	varDecl := p.Arena.NewVarDecl(ast.VarDecl{})
 
 	if p.CurTok.TokenType == ast.TokenTypeMut {
 		varDecl.Mut = true
@@ -47,13 +50,13 @@ func (p *Parser) ParseVarDecl() (ast.Decl, error) {
 		return varDecl, fmt.Errorf("could not parse variable type: %s", err.Error())
 	}
 	varDecl.Type = ty
-	varDecl.Names = p.ParseIdentList()
+	varDecl.Names, varDecl.Syms = p.ParseIdentList()
 
 	if p.CurTok.TokenType != ast.TokenTypeEq {
 		// if there's no '=' assign each of them to null
 		varDecl.Values = make([]ast.Expr, len(varDecl.Names))
 		for i := range varDecl.Values {
-			varDecl.Values[i] = ast.NullExpr{Pos: p.CurTok.Pos, Type: p.CurType}
+			varDecl.Values[i] = p.Arena.NewNullExpr(ast.NullExpr{Pos: p.CurTok.Pos, Type: p.CurType})
 		}
 		return varDecl, nil
 	}
@@ -75,13 +78,14 @@ func (p *Parser) ParseVarDecl() (ast.Decl, error) {
 	return varDecl, nil
 }
 
-func (p *Parser) ParseTypeDecl() (ast.TypeDecl, error) {
-	var typeDecl ast.TypeDecl
+func (p *Parser) ParseTypeDecl() (*ast.TypeDecl, error) {
+	typeDecl := p.Arena.NewTypeDecl(ast.TypeDecl{})
 
 	p.EatToken()
 
 	p.Expect(ast.TokenTypeIdentifier, "expected identifier following type declaration")
 	typeDecl.Name = p.CurTok.Value
+	typeDecl.Sym = p.CurTok.Sym
 	p.EatToken()
 
 	typeValue, err := p.ParseType()
@@ -90,7 +94,7 @@ func (p *Parser) ParseTypeDecl() (ast.TypeDecl, error) {
 	}
 	typeDecl.Type = typeValue
 
-	p.KnownIdentifierTypes[typeDecl.Name] = &typeDecl
+	p.AddKnownType(typeDecl)
 
 	return typeDecl, nil
 }
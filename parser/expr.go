@@ -6,122 +6,154 @@ import (
 	"github.com/IbrahimFadel/pi-lang/ast"
 )
 
+/*
+ * Parse an expression with a stack of operators that are waiting on their right hand side instead of recursing,
+ * so an expression with a million terms or a million parentheses takes linear time and doesn't grow the goroutine stack
+ * Each frame on the stack stands in for a call of a recursive descent parser that hasn't returned yet
+ */
 func (p *Parser) ParseExpr() (ast.Expr, error) {
-	x, err := p.ParseBinaryExpr(1)
+	// Expressions can start inside one another through an OpOther's Parse, so each only touches the stacks above where it started
+	opsBase, operandsBase := len(p.exprOps), len(p.exprOperands)
+	// Deferred so an error that bails out of the statement doesn't leave this expression's frames behind
+	defer func() {
+		p.exprOps = p.exprOps[:opsBase]
+		p.exprOperands = p.exprOperands[:operandsBase]
+	}()
+
+	x, err := p.parseExprStack(opsBase)
 	if err != nil {
 		return x, fmt.Errorf("could not parse expression: %s", err.Error())
 	}
 	return x, nil
 }
 
-func (p *Parser) ParseBinaryExpr(prec1 int) (ast.Expr, error) {
-	x, err := p.ParseUnaryExpr()
-	if err != nil {
-		return x, fmt.Errorf("could not parse unary expression: %s", err.Error())
-	}
+// An operator on ParseExpr's stack
+type exprFrame struct {
+	Kind  OpKind
+	Op    ast.TokenType
+	Pos   ast.TokenPos
+	Prec1 int // Operators that bind at least this tightly are part of its right hand side
+	Fn    int // Index in the operand stack of a call's function, its arguments are the operands after it
+}
 
+func (p *Parser) parseExprStack(base int) (ast.Expr, error) {
 	for {
-		oprec := p.TokenPrecedence(p.CurTok)
-		op := p.CurTok.TokenType
-		opPos := p.CurTok.Pos
-
-		if oprec < prec1 {
-			return x, nil
-		}
-		p.EatToken()
-		y, err := p.ParseBinaryExpr(oprec + 1)
-		if err != nil {
-			return x, fmt.Errorf("could not parse binary expression: %s", err.Error())
+		// Prefix operators and parentheses, then the operand they apply to
+		for operand := false; !operand; {
+			prefix := PrefixOps[p.CurTok.TokenType]
+			switch {
+			case prefix.Kind == OpUnary:
+				p.exprOps = append(p.exprOps, exprFrame{Kind: OpUnary, Op: p.CurTok.TokenType, Pos: p.CurTok.Pos, Prec1: unaryPrecedence})
+				p.EatToken()
+			case prefix.Kind == OpParen:
+				p.exprOps = append(p.exprOps, exprFrame{Kind: OpParen, Prec1: 1})
+				p.EatToken()
+			case prefix.Parse == nil:
+				return nil, fmt.Errorf("unknown expression: %s", p.CurTok.Value)
+			default:
+				x, err := prefix.Parse(p)
+				if err != nil {
+					return x, err
+				}
+				p.exprOperands = append(p.exprOperands, x)
+				operand = true
+			}
 		}
-		x = ast.BinaryExpr{X: x, OpPos: opPos, Op: op, Y: y}
-		x, err = p.ParsePostfixExpr(x)
-		if err != nil {
-			return x, fmt.Errorf("could not parse postfix expression: %s", err.Error())
-		}
-	}
-}
 
-// TODO: do i need to do err checking here for more detailed errors? too tired rn to think
-func (p *Parser) ParsePostfixExpr(x ast.Expr) (ast.Expr, error) {
-	switch p.CurTok.TokenType {
-	default:
-		return x, nil
-	case ast.TokenTypeOpenParen:
-		return p.ParseFnCallExpr(x)
-	}
-}
-
-func (p *Parser) ParseFnCallExpr(x ast.Expr) (ast.Expr, error) {
-	// I don't think this is necessary, but just in case
-	p.Expect(ast.TokenTypeOpenParen, "expected '(' in function call expression")
-	openParenPos := p.CurTok.Pos
-	p.EatToken()
-
-	args, err := p.ParseCallArgs()
-	if err != nil {
-		return x, fmt.Errorf("could not parse function call arguments: %s", err.Error())
-	}
-	p.Expect(ast.TokenTypeCloseParen, "expected ')' at end of function call argument list") // I think this is redundant, but just in case
-	closeParenPos := p.CurTok.Pos
-	p.EatToken()
-
-	return ast.CallExpr{Fn: x, Args: args, OpenParenPos: openParenPos, CloseParenPos: closeParenPos}, nil
-}
-
-/*
- * This function expects '(' to have already been consumed
- * and it does *not* consume ')'.
- */
-func (p *Parser) ParseCallArgs() ([]ast.Expr, error) {
-	var args []ast.Expr
-	for p.CurTok.TokenType != ast.TokenTypeCloseParen {
-		x, err := p.ParseExpr()
-		if err != nil {
-			return args, fmt.Errorf("could not parse expression: %s", err.Error())
-		}
-		args = append(args, x)
-		if p.CurTok.TokenType == ast.TokenTypeComma {
-			p.EatToken()
-		} else if p.CurTok.TokenType != ast.TokenTypeCloseParen {
-			return args, fmt.Errorf("expected ')' at end of function call argument list")
+		// Infix operators and the ends of parentheses and calls, until an operator needs another operand
+		for operand := false; !operand; {
+			infix := InfixOps[p.CurTok.TokenType]
+			for top := len(p.exprOps) - 1; top >= base && infix.Precedence < p.exprOps[top].Prec1; top-- {
+				if kind := p.exprOps[top].Kind; kind != OpUnary && kind != OpBinary {
+					break
+				}
+				p.reduceExprOp()
+			}
+
+			if infix.Precedence > 0 {
+				switch infix.Kind {
+				case OpBinary:
+					prec := infix.Precedence
+					if !infix.RightAssoc {
+						prec++
+					}
+					p.exprOps = append(p.exprOps, exprFrame{Kind: OpBinary, Op: p.CurTok.TokenType, Pos: p.CurTok.Pos, Prec1: prec})
+					p.EatToken()
+					operand = true
+				case OpCall:
+					p.exprOps = append(p.exprOps, exprFrame{Kind: OpCall, Pos: p.CurTok.Pos, Prec1: 1, Fn: len(p.exprOperands) - 1})
+					p.EatToken()
+					if p.CurTok.TokenType == ast.TokenTypeCloseParen {
+						p.reduceCall()
+					} else {
+						operand = true
+					}
+				default:
+					top := len(p.exprOperands) - 1
+					x, err := infix.Parse(p, p.exprOperands[top])
+					if err != nil {
+						return x, fmt.Errorf("could not parse binary expression: %s", err.Error())
+					}
+					p.exprOperands[top] = x
+				}
+				continue
+			}
+
+			// Not an operator, so it ends whatever the innermost parentheses or call are, or the whole expression
+			top := len(p.exprOps) - 1
+			if top < base {
+				return p.exprOperands[len(p.exprOperands)-1], nil
+			}
+			if p.exprOps[top].Kind == OpParen {
+				p.Expect(ast.TokenTypeCloseParen, "expected ')' at end of parenthesized expression")
+				p.EatToken()
+				p.exprOps = p.exprOps[:top]
+				continue
+			}
+			if p.CurTok.TokenType == ast.TokenTypeComma {
+				p.EatToken()
+				operand = p.CurTok.TokenType != ast.TokenTypeCloseParen
+			} else if p.CurTok.TokenType != ast.TokenTypeCloseParen {
+				return nil, fmt.Errorf("could not parse function call arguments: expected ')' at end of function call argument list")
+			}
+			if !operand {
+				p.reduceCall()
+			}
 		}
 	}
-
-	return args, nil
 }
 
-func (p *Parser) ParseUnaryExpr() (ast.Expr, error) {
-	switch p.CurTok.TokenType {
-	default:
-		return p.ParsePrimaryExpr()
-	case ast.TokenTypeAmpersand, ast.TokenTypeAsterisk:
-		// TODO: implement
-		return ast.ExprStmt{}, nil
+// Pop the unary or binary operator on top of the stack and its operands, and push the expression they make
+func (p *Parser) reduceExprOp() {
+	op := p.exprOps[len(p.exprOps)-1]
+	p.exprOps = p.exprOps[:len(p.exprOps)-1]
+	n := len(p.exprOperands)
+	if op.Kind == OpUnary {
+		p.exprOperands[n-1] = p.Arena.NewUnaryExpr(ast.UnaryExpr{OpPos: op.Pos, Op: op.Op, X: p.exprOperands[n-1]})
+		return
 	}
+	p.exprOperands[n-2] = p.Arena.NewBinaryExpr(ast.BinaryExpr{X: p.exprOperands[n-2], OpPos: op.Pos, Op: op.Op, Y: p.exprOperands[n-1]})
+	p.exprOperands = p.exprOperands[:n-1]
 }
 
-func (p *Parser) ParsePrimaryExpr() (ast.Expr, error) {
-	switch p.CurTok.TokenType {
-	default:
-		var x ast.Expr
-		return x, fmt.Errorf(fmt.Sprintf("unknown expression: %s", p.CurTok.Value))
-	case ast.TokenTypeNumberLiteral:
-		return p.ParseNumberLit()
-	case ast.TokenTypeStringLiteral:
-		return p.ParseStringLit()
-	case ast.TokenTypeIdentifier:
-		return p.ParseIdentifier()
-	}
+// Pop the call on top of the stack, whose ')' is CurTok, and push its CallExpr
+func (p *Parser) reduceCall() {
+	call := p.exprOps[len(p.exprOps)-1]
+	p.exprOps = p.exprOps[:len(p.exprOps)-1]
+	args := append([]ast.Expr(nil), p.exprOperands[call.Fn+1:]...)
+	x := p.Arena.NewCallExpr(ast.CallExpr{Fn: p.exprOperands[call.Fn], Args: args, OpenParenPos: call.Pos, CloseParenPos: p.CurTok.Pos})
+	p.EatToken()
+	p.exprOperands = append(p.exprOperands[:call.Fn], x)
 }
 
-func (p *Parser) ParseNumberLit() (ast.NumberLitExpr, error) {
-	num := ast.NumberLitExpr{ValuePos: p.CurTok.Pos, Value: p.CurTok.Value, Type: p.CurType}
+func (p *Parser) ParseNumberLit() (*ast.NumberLitExpr, error) {
+	num := p.Arena.NewNumberLitExpr(ast.NumberLitExpr{ValuePos: p.CurTok.Pos, Value: p.CurTok.Value, Type: p.CurType})
 	p.EatToken()
 	return num, nil
 }
 
-func (p *Parser) ParseStringLit() (ast.StringLitExpr, error) {
-	str := ast.StringLitExpr{ValuePos: p.CurTok.Pos, Value: p.CurTok.Value}
+func (p *Parser) ParseStringLit() (*ast.StringLitExpr, error) {
+	str := p.Arena.NewStringLitExpr(ast.StringLitExpr{ValuePos: p.CurTok.Pos, Value: p.CurTok.Value})
 	p.EatToken()
 	return str, nil
 }
@@ -132,9 +164,10 @@ func (p *Parser) ParseIdentifier() (ast.Expr, error) {
 	// }
 
 	name := p.CurTok.Value
+	sym := p.CurTok.Sym
 	pos := p.CurTok.Pos
 	p.EatToken()
-	return ast.VarRefExpr{Name: name, Pos: pos}, nil
+	return p.Arena.NewVarRefExpr(ast.VarRefExpr{Name: name, Sym: sym, Pos: pos}), nil
 }
 
 // func (p *Parser) ParseExpr() (ast.Expr, error) {
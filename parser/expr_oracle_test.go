@@ -0,0 +1,130 @@
+package parser
+
+import (
+	"fmt"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+)
+
+/*
+ * The recursive descent parser ParseExpr replaced, kept to check ParseExpr builds the same AST
+ * Parse an expression made of operators that bind at least as tightly as prec1, recursing for every operator
+ */
+func (p *Parser) ParseBinaryExpr(prec1 int) (ast.Expr, error) {
+	x, err := p.ParseUnaryExpr()
+	if err != nil {
+		return x, fmt.Errorf("could not parse unary expression: %s", err.Error())
+	}
+
+	for {
+		op := InfixOps[p.CurTok.TokenType]
+		if op.Precedence < prec1 {
+			return x, nil
+		}
+		switch op.Kind {
+		case OpBinary:
+			x, err = p.ParseBinaryOp(x)
+		case OpCall:
+			x, err = p.ParseFnCallExpr(x)
+		default:
+			x, err = op.Parse(p, x)
+		}
+		if err != nil {
+			return x, fmt.Errorf("could not parse binary expression: %s", err.Error())
+		}
+	}
+}
+
+// Parse the operator in CurTok and its right hand side
+func (p *Parser) ParseBinaryOp(x ast.Expr) (ast.Expr, error) {
+	op := p.CurTok.TokenType
+	opPos := p.CurTok.Pos
+	prec := InfixOps[op].Precedence
+	if !InfixOps[op].RightAssoc {
+		prec++
+	}
+	p.EatToken()
+
+	y, err := p.ParseBinaryExpr(prec)
+	if err != nil {
+		return x, err
+	}
+	return p.Arena.NewBinaryExpr(ast.BinaryExpr{X: x, OpPos: opPos, Op: op, Y: y}), nil
+}
+
+func (p *Parser) ParseFnCallExpr(x ast.Expr) (ast.Expr, error) {
+	p.Expect(ast.TokenTypeOpenParen, "expected '(' in function call expression")
+	openParenPos := p.CurTok.Pos
+	p.EatToken()
+
+	args, err := p.ParseCallArgs()
+	if err != nil {
+		return x, fmt.Errorf("could not parse function call arguments: %s", err.Error())
+	}
+	p.Expect(ast.TokenTypeCloseParen, "expected ')' at end of function call argument list")
+	closeParenPos := p.CurTok.Pos
+	p.EatToken()
+
+	return p.Arena.NewCallExpr(ast.CallExpr{Fn: x, Args: args, OpenParenPos: openParenPos, CloseParenPos: closeParenPos}), nil
+}
+
+// Expects '(' to have already been consumed, and doesn't consume ')'
+func (p *Parser) ParseCallArgs() ([]ast.Expr, error) {
+	var args []ast.Expr
+	for p.CurTok.TokenType != ast.TokenTypeCloseParen {
+		x, err := p.ParseBinaryExpr(1)
+		if err != nil {
+			return args, fmt.Errorf("could not parse expression: %s", err.Error())
+		}
+		args = append(args, x)
+		if p.CurTok.TokenType == ast.TokenTypeComma {
+			p.EatToken()
+		} else if p.CurTok.TokenType != ast.TokenTypeCloseParen {
+			return args, fmt.Errorf("expected ')' at end of function call argument list")
+		}
+	}
+
+	return args, nil
+}
+
+func (p *Parser) ParseUnaryExpr() (ast.Expr, error) {
+	prefix := PrefixOps[p.CurTok.TokenType]
+	switch {
+	case prefix.Kind == OpUnary:
+		return p.ParseUnaryOp()
+	case prefix.Kind == OpParen:
+		return p.ParseParenExpr()
+	case prefix.Parse == nil:
+		return nil, fmt.Errorf("unknown expression: %s", p.CurTok.Value)
+	}
+	return prefix.Parse(p)
+}
+
+// Parse '-x', '&x' or '*x'
+func (p *Parser) ParseUnaryOp() (ast.Expr, error) {
+	op := p.CurTok.TokenType
+	opPos := p.CurTok.Pos
+	p.EatToken()
+
+	x, err := p.ParseBinaryExpr(unaryPrecedence)
+	if err != nil {
+		return x, err
+	}
+	return p.Arena.NewUnaryExpr(ast.UnaryExpr{OpPos: opPos, Op: op, X: x}), nil
+}
+
+func (p *Parser) ParseParenExpr() (ast.Expr, error) {
+	p.EatToken()
+	x, err := p.ParseBinaryExpr(1)
+	if err != nil {
+		return x, err
+	}
+	p.Expect(ast.TokenTypeCloseParen, "expected ')' at end of parenthesized expression")
+	p.EatToken()
+	return x, nil
+}
+
+// How many frames and operands ParseExpr has left on its stacks, it should always be none between expressions
+func (p *Parser) ExprStackDepth() (int, int) {
+	return len(p.exprOps), len(p.exprOperands)
+}
@@ -7,8 +7,8 @@ import (
 )
 
 func (p *Parser) ParseFn() (ast.Node, error) {
-	var fnDec ast.FuncDecl
-	p.CurFunc = &fnDec
+	fnDec := p.Arena.NewFuncDecl(ast.FuncDecl{})
+	p.CurFunc = fnDec
 
 	p.EatToken()
 
@@ -22,6 +22,7 @@ func (p *Parser) ParseFn() (ast.Node, error) {
 
 	p.Expect(ast.TokenTypeIdentifier, "expected identifier following 'fn'")
 	fnDec.Name = p.CurTok.Value
+	fnDec.Sym = p.CurTok.Sym
 	p.EatToken()
 
 	fnType, err := p.ParseFuncType()
@@ -30,6 +31,11 @@ func (p *Parser) ParseFn() (ast.Node, error) {
 	}
 	fnDec.FuncType = fnType
 
+	if p.LazyBodies && p.Lexer == nil {
+		fnDec.Lazy = p.SkipBody()
+		return fnDec, nil
+	}
+
 	fnBody, err := p.ParseBlockStmt()
 	if err != nil {
 		return nil, fmt.Errorf("could not parse function body: %s", err.Error())
@@ -40,6 +46,69 @@ func (p *Parser) ParseFn() (ast.Node, error) {
 	return fnDec, nil
 }
 
+// Move past a function body by matching braces, without parsing anything in it
+func (p *Parser) SkipBody() *ast.LazyBody {
+	p.Expect(ast.TokenTypeOpenCurlyBracket, "expected '{' at beggining of block statement")
+	lazy := &ast.LazyBody{Start: p.TokIndex, Type: p.CurType, Parser: p}
+	depth := 0
+	for i := p.TokIndex; i < len(p.Tokens); i++ {
+		switch p.Tokens[i].TokenType {
+		case ast.TokenTypeOpenCurlyBracket:
+			depth++
+		case ast.TokenTypeCloseCurlyBracket:
+			depth--
+			if depth == 0 {
+				lazy.End = i + 1
+				p.TokIndex = i
+				p.EatToken()
+				return lazy
+			}
+		}
+	}
+	// The body runs into the end of the file
+	p.TokIndex = len(p.Tokens) - 1
+	p.EatToken()
+	p.Error(p.CurTok.Pos, "expected '}' at end of function body")
+	return nil
+}
+
+/*
+ * Parse a body SkipBody skipped, on a parser of its own so p can be anywhere in its tokens
+ * Errors are added to p.Errors when recovering, and returned as Diagnostics if there were any
+ * Types are only known if they're declared before the body, however much of the file has been parsed since it was skipped
+ */
+func (p *Parser) ParseBody(fn *ast.FuncDecl) (body ast.BlockStmt, err error) {
+	var sub Parser
+	sub.Init(p.Tokens[fn.Lazy.Start:fn.Lazy.End:fn.Lazy.End])
+	sub.TokOffset = p.TokOffset + fn.Lazy.Start
+	sub.Arena = p.Arena
+	sub.KnownIdentifierTypes = p.KnownIdentifierTypes
+	sub.KnownTypesFrom = p.KnownTypesFrom
+	sub.SharedTypes = true
+	sub.CurType = fn.Lazy.Type
+	sub.CurFunc = fn
+	sub.Recover = p.Recover
+
+	defer func() {
+		if r := recover(); r != nil {
+			if _, isBailout := r.(bailout); !isBailout {
+				panic(r)
+			}
+		}
+		if len(sub.Errors) > 0 {
+			p.Errors = append(p.Errors, sub.Errors...)
+			err = Diagnostics(sub.Errors)
+		}
+	}()
+
+	body, err = sub.ParseBlockStmt()
+	if err != nil {
+		return body, fmt.Errorf("could not parse function body: %s", err.Error())
+	}
+	body.Name = "entry"
+	return body, nil
+}
+
 func (p *Parser) ParseFuncReceiver() (ast.FuncReceiver, error) {
 	p.Expect(ast.TokenTypeOpenParen, "expected '(' in function receiver")
 	pos := p.CurTok.Pos
@@ -83,7 +152,7 @@ func (p *Parser) ParseFuncType() (ast.FuncType, error) {
 		fnType.Return = returnType
 	} else {
 		// If you don't specify return type, it's a void function
-		fnType.Return = ast.PrimitiveTypeExpr{PrimitiveType: ast.TokenTypeVoid, Pos: p.CurTok.Pos}
+		fnType.Return = p.Arena.NewPrimitiveTypeExpr(ast.PrimitiveTypeExpr{PrimitiveType: ast.TokenTypeVoid, Pos: p.CurTok.Pos})
 	}
 
 	return fnType, nil
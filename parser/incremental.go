@@ -0,0 +1,526 @@
+package parser
+
+import (
+	"bytes"
+	"sort"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+)
+
+// Bytes past the end of an edit that are lexed at first when looking for where the tokens line back up, doubled until they're enough
+const regionLookahead = 4 << 10
+
+// The bytes Start to End of the old source replaced with Text
+type Edit struct {
+	Start, End int
+	Text       []byte
+}
+
+// A top level declaration of an Incremental parse and the part of the source it was parsed from
+type IncrementalDecl struct {
+	Start, End int           // Range in the source
+	Line, Col  int           // Newlines before Start and bytes between the last of them and Start
+	Node       ast.Node      // nil if the declaration had an error
+	Errors     []Diagnostic  // Errors in this declaration
+	Type       *ast.TypeDecl // The type it declares, if it's a type declaration that parsed
+
+	nodeLine, nodeCol int // Line and Col the positions in Node and Errors were worked out for
+}
+
+/*
+ * A parse of a file that can be brought up to date after an edit without parsing the whole file again
+ *
+ * A declaration is never parsed past the next 'fn', 'type' or 'package' token, even when recovering from an error,
+ * so the declarations after an edit still parse the same way once the lexer lines back up with one of those tokens they start with
+ * Reparse only lexes and parses from the declaration the edit starts in to the first declaration after it that lines back up,
+ * every other declaration's node is kept as it was
+ *
+ * A type is known from the declaration after its own on, like it is for GenerateAST, so the region is parsed knowing the types declared before it
+ * If an edit changes which types are declared the whole file is parsed again, the declarations after it could parse differently
+ *
+ * Reparse costs about as much as the declarations it parses, however big the file is:
+ * The source and the declarations are both gap buffers with the gap left where the last edit was, so only what's between two edits moves
+ * The declarations after the gap have their offsets and line counted back from the end of the source, an edit before them doesn't change them
+ * Kept nodes have their positions moved to where their declaration is now when it's read with Decl or Collect, not on every edit
+ */
+type Incremental struct {
+	Parser Parser    // Nodes and Errors are for the whole file once Collect is called, set Parser.Arena to allocate nodes there
+	Lexer  ast.Lexer // Set Lexer.Symbols to share Symbols with other files
+
+	src         []byte // The source, with a gap from src[gap] to src[gapEnd]
+	gap, gapEnd int
+	lines       int               // Newlines in the source
+	head        []IncrementalDecl // Declarations before the gap
+	tail        []IncrementalDecl // Declarations after the gap, last first, with Start, End and Line counted back from the end of the source
+	typeCount   []int             // By Symbol, how many declarations in head declare it, Parser's known types are the ones declared in head
+}
+
+// Parse all of src, it's copied so edits don't change the caller's
+func (inc *Incremental) Parse(src []byte) {
+	inc.src = append([]byte(nil), src...)
+	inc.gap, inc.gapEnd = len(src), len(src)
+	inc.lines = bytes.Count(src, []byte{'\n'})
+	inc.parseAll()
+}
+
+func (inc *Incremental) parseAll() {
+	inc.head, inc.tail, inc.typeCount = nil, nil, nil
+	inc.Parser.InitTables()
+	inc.moveGap(inc.Size())
+	decls, _, _, _ := inc.parseRegion(0, 0, 0, -1)
+	for _, decl := range decls {
+		inc.pushDecl(decl)
+	}
+}
+
+// Length of the source
+func (inc *Incremental) Size() int {
+	return len(inc.src) - (inc.gapEnd - inc.gap)
+}
+
+// The whole source, the gap is moved to the end to get it in one piece
+func (inc *Incremental) Source() []byte {
+	inc.moveGap(inc.Size())
+	return inc.src[:inc.gap]
+}
+
+// Move the gap in the source to offset at
+func (inc *Incremental) moveGap(at int) {
+	if at < inc.gap {
+		n := inc.gap - at
+		copy(inc.src[inc.gapEnd-n:inc.gapEnd], inc.src[at:inc.gap])
+		inc.gap, inc.gapEnd = at, inc.gapEnd-n
+	} else if at > inc.gap {
+		n := at - inc.gap
+		copy(inc.src[inc.gap:], inc.src[inc.gapEnd:inc.gapEnd+n])
+		inc.gap, inc.gapEnd = at, inc.gapEnd+n
+	}
+}
+
+// Replace the bytes edit covers, leaving the gap right after the new text
+func (inc *Incremental) splice(edit Edit) {
+	inc.moveGap(edit.End)
+	inc.lines -= bytes.Count(inc.src[edit.Start:edit.End], []byte{'\n'})
+	inc.lines += bytes.Count(edit.Text, []byte{'\n'})
+	inc.gap = edit.Start
+	if inc.gapEnd-inc.gap < len(edit.Text) {
+		after := len(inc.src) - inc.gapEnd
+		grown := make([]byte, 2*(inc.gap+len(edit.Text)+after)+regionLookahead)
+		copy(grown, inc.src[:inc.gap])
+		copy(grown[len(grown)-after:], inc.src[inc.gapEnd:])
+		inc.src, inc.gapEnd = grown, len(grown)-after
+	}
+	inc.gap += copy(inc.src[inc.gap:], edit.Text)
+}
+
+// Number of declarations
+func (inc *Incremental) Len() int {
+	return len(inc.head) + len(inc.tail)
+}
+
+// Declaration i, with the positions in its node moved to where it is now if an edit has moved it
+func (inc *Incremental) Decl(i int) IncrementalDecl {
+	var stored *IncrementalDecl
+	var decl IncrementalDecl
+	if i < len(inc.head) {
+		stored = &inc.head[i]
+		decl = *stored
+	} else {
+		stored = &inc.tail[len(inc.tail)-1-(i-len(inc.head))]
+		decl = inc.flip(*stored)
+	}
+	if decl.Line != decl.nodeLine || decl.Col != decl.nodeCol {
+		decl.Move(decl.nodeLine+1, decl.Line-decl.nodeLine, decl.Col-decl.nodeCol)
+		stored.nodeLine, stored.nodeCol = decl.Line, decl.Col
+		decl.nodeLine, decl.nodeCol = decl.Line, decl.Col
+	}
+	return decl
+}
+
+// Offset of the start of declaration i
+func (inc *Incremental) start(i int) int {
+	if i < len(inc.head) {
+		return inc.head[i].Start
+	}
+	return inc.tailStart(len(inc.tail) - 1 - (i - len(inc.head)))
+}
+
+func (inc *Incremental) tailStart(j int) int {
+	return inc.Size() - inc.tail[j].Start
+}
+
+// Count a declaration after the gap's offsets and line from the start of the source instead of the end, or the other way around
+func (inc *Incremental) flip(decl IncrementalDecl) IncrementalDecl {
+	size := inc.Size()
+	decl.Start, decl.End, decl.Line = size-decl.Start, size-decl.End, inc.lines-decl.Line
+	return decl
+}
+
+// Add decl to the end of head, the type it declares is known to the declarations after it
+func (inc *Incremental) pushDecl(decl IncrementalDecl) {
+	inc.head = append(inc.head, decl)
+	if decl.Type == nil {
+		return
+	}
+	sym := decl.Type.Sym
+	for int(sym) >= len(inc.typeCount) {
+		inc.typeCount = append(inc.typeCount, 0)
+	}
+	inc.typeCount[sym]++
+	inc.Parser.addKnownType(decl.Type, 0)
+}
+
+// Move the gap in the declarations to before declaration n
+func (inc *Incremental) moveDecls(n int) {
+	for len(inc.head) > n {
+		decl := inc.head[len(inc.head)-1]
+		inc.head[len(inc.head)-1] = IncrementalDecl{}
+		inc.head = inc.head[:len(inc.head)-1]
+		if decl.Type != nil {
+			inc.forgetType(decl.Type.Sym)
+		}
+		inc.tail = append(inc.tail, inc.flip(decl))
+	}
+	for len(inc.head) < n {
+		decl := inc.flip(inc.tail[len(inc.tail)-1])
+		inc.tail[len(inc.tail)-1] = IncrementalDecl{}
+		inc.tail = inc.tail[:len(inc.tail)-1]
+		inc.pushDecl(decl)
+	}
+}
+
+// One less declaration in head declares sym, it isn't known any more if that was the last
+func (inc *Incremental) forgetType(sym ast.Symbol) {
+	inc.typeCount[sym]--
+	if inc.typeCount[sym] == 0 {
+		inc.Parser.KnownIdentifierTypes[sym] = nil
+	}
+}
+
+// Whether an edit from offset at on changes the first token of declaration i (or the byte after it that ended it)
+func (inc *Incremental) editsFirstToken(i, at int) bool {
+	start := inc.start(i)
+	inc.moveGap(at)
+	inc.Lexer.Reset(inc.src[start:at])
+	inc.Lexer.ScanUntil(1)
+	return len(inc.Lexer.Spans) == 0 || inc.Lexer.Spans[0].End() >= at-start
+}
+
+// Apply edit to the source and parse what it changed
+func (inc *Incremental) Reparse(edit Edit) {
+	// The declaration the edit starts in, or the one before if the edit changes its first token, that can change where the one before ends
+	n := inc.Len()
+	first := sort.Search(n, func(i int) bool { return inc.start(i) > edit.Start }) - 1
+	if first > 0 && inc.editsFirstToken(first, edit.Start) {
+		first--
+	}
+	if first < 0 {
+		inc.splice(edit)
+		inc.parseAll()
+		return
+	}
+
+	// The declarations after the edit, any of them could be where the new tokens line back up with the old ones
+	after := first + 1
+	for after < n && inc.start(after) < edit.End {
+		after++
+	}
+
+	// Everything from first on goes after the gap, so the declarations after the edit don't change when it's applied
+	inc.moveDecls(first)
+	from := inc.flip(inc.tail[len(inc.tail)-1])
+	inc.splice(edit)
+
+	decls, resync, _, endPos := inc.parseRegion(from.Start, from.Line, from.Col, len(inc.tail)-1-(after-first))
+	replaced := inc.tail[resync+1:]
+	if !SameTypes(replaced, decls) {
+		inc.parseAll()
+		return
+	}
+
+	// The declaration that lined back up has the right line already, but it (and the others on its line) can have moved along the line
+	if resync >= 0 {
+		line := inc.tail[resync].Line
+		cols := endPos.Col - 1 - inc.tail[resync].Col
+		for j := resync; j >= 0 && inc.tail[j].Line == line; j-- {
+			inc.tail[j].Col += cols
+		}
+	}
+
+	for j := range replaced {
+		replaced[j] = IncrementalDecl{}
+	}
+	inc.tail = inc.tail[:resync+1]
+	for _, decl := range decls {
+		inc.pushDecl(decl)
+	}
+}
+
+/*
+ * Lex and parse the source from offset from until the tokens line up with the start of one of the declarations after the gap again
+ * line and col are where from is, like IncrementalDecl.Line and Col, the types declared before the gap are known from the start
+ * after is the index in tail of the first declaration that could line up
+ * Returns the declarations parsed, the index in tail of the one that lined up (or -1) and the offset and position parsing stopped at
+ */
+func (inc *Incremental) parseRegion(from, line, col, after int) (decls []IncrementalDecl, resync int, end int, endPos ast.TokenPos) {
+	lexer := &inc.Lexer
+	size := inc.Size()
+	edited := inc.gap
+
+	var tokens []ast.Token
+	var offsets []int
+	stop := -1 // Index in tokens of the first token that isn't parsed
+
+	// Only the source before the gap is in one piece, it's moved along until what's lexed reaches a declaration that lines up
+	for ahead := regionLookahead; ; ahead *= 2 {
+		limit := edited + ahead
+		if limit > size {
+			limit = size
+		}
+		inc.moveGap(limit)
+		lexer.Reset(inc.src[from:limit])
+
+		tokens, offsets, stop, resync = tokens[:0], offsets[:0], -1, after
+		whole := false
+		for n, more := 0, true; more && stop < 0; {
+			more = lexer.Scan()
+			for ; n < len(lexer.Spans) && stop < 0; n++ {
+				span := lexer.Spans[n]
+				offset := from + int(span.Start)
+				for resync >= 0 && inc.tailStart(resync) < offset {
+					resync--
+				}
+
+				tok := lexer.Token(span)
+				if span.TokenType() != ast.TokenTypeEOF {
+					// Tokens are lexed from the middle of the file, so their positions are offset by where from is
+					if tok.Pos.Row == 1 {
+						tok.Pos.Col += col
+					}
+					tok.Pos.Row += line
+				}
+				tokens = append(tokens, tok)
+				offsets = append(offsets, offset)
+
+				/*
+				 * The token that lines back up is kept so errors right before it are reported the same way they were
+				 * It has to start a declaration, a declaration that starts anywhere else only did because of how the one before it ended
+				 */
+				if span.TokenType() == ast.TokenTypeEOF || resync >= 0 && inc.tailStart(resync) == offset && isDeclStart(span.TokenType()) {
+					stop = len(tokens) - 1
+					// A token that runs into the gap could have been cut short
+					whole = limit == size || span.End() < len(lexer.Src)
+				}
+			}
+		}
+		if whole {
+			break
+		}
+	}
+	end = offsets[stop]
+	endPos = tokens[stop].Pos
+
+	// The types this declares are added to the same tables, and taken back out once it's parsed
+	var p Parser
+	p.Init(tokens)
+	p.Arena = inc.Parser.Arena
+	p.KnownIdentifierTypes = inc.Parser.KnownIdentifierTypes
+	p.KnownTypesFrom = inc.Parser.KnownTypesFrom
+	p.Recover = true
+
+	for p.TokIndex < stop {
+		decl := IncrementalDecl{Start: offsets[p.TokIndex], Line: p.CurTok.Pos.Row - 1, Col: p.CurTok.Pos.Col - 1}
+		if len(decls) == 0 {
+			decl.Start, decl.Line, decl.Col = from, line, col
+		} else {
+			decls[len(decls)-1].End = decl.Start
+		}
+		decl.nodeLine, decl.nodeCol = decl.Line, decl.Col
+
+		// Only a type declaration that parses is added to the known types
+		errors := len(p.Errors)
+		if node, ok := p.ParseDeclRecovering(); ok {
+			decl.Node = node
+			decl.Type, _ = node.(*ast.TypeDecl)
+		}
+		decl.Errors = p.Errors[errors:len(p.Errors):len(p.Errors)]
+		decls = append(decls, decl)
+	}
+	if len(decls) > 0 {
+		decls[len(decls)-1].End = end
+	}
+
+	inc.Parser.KnownIdentifierTypes, inc.Parser.KnownTypesFrom = p.KnownIdentifierTypes, p.KnownTypesFrom
+	for _, decl := range decls {
+		if decl.Type != nil {
+			sym := decl.Type.Sym
+			if int(sym) >= len(inc.typeCount) || inc.typeCount[sym] == 0 {
+				inc.Parser.KnownIdentifierTypes[sym] = nil
+			}
+			inc.Parser.KnownTypesFrom[sym] = 0
+		}
+	}
+	return decls, resync, end, endPos
+}
+
+// Move the positions in decl from row on down by lines, and the ones on row along by cols
+func (decl *IncrementalDecl) Move(row, lines, cols int) {
+	move := func(pos *ast.TokenPos) {
+		if pos.Row == row {
+			pos.Col += cols
+		}
+		if pos.Row >= row {
+			pos.Row += lines
+		}
+	}
+	for i := range decl.Errors {
+		move(&decl.Errors[i].Pos)
+	}
+	if decl.Node != nil {
+		MovePositions(decl.Node, move)
+	}
+}
+
+/*
+ * Call move on every position in node
+ * Type expressions can be shared (a number literal's Type is the type it took it from), they're only moved once
+ */
+func MovePositions(node ast.Node, move func(pos *ast.TokenPos)) {
+	seen := make(map[ast.Node]bool)
+	stack := []ast.Node{node}
+	params := func(list *ast.ParamList) {
+		move(&list.Start)
+		move(&list.End)
+		for _, param := range list.Params {
+			stack = append(stack, param.Type)
+		}
+	}
+	block := func(block *ast.BlockStmt) {
+		move(&block.Start)
+		move(&block.End)
+		for _, stmt := range block.List {
+			stack = append(stack, stmt)
+		}
+	}
+
+	// Expressions can be millions of terms deep, so they're walked with a stack instead of recursing
+	for len(stack) > 0 {
+		node := stack[len(stack)-1]
+		stack = stack[:len(stack)-1]
+		if node == nil || seen[node] {
+			continue
+		}
+		seen[node] = true
+
+		switch n := node.(type) {
+		case *ast.FuncDecl:
+			if n.Receiver != (ast.FuncReceiver{}) {
+				move(&n.Receiver.Pos)
+				stack = append(stack, n.Receiver.Type)
+			}
+			move(&n.FuncType.FuncPos)
+			params(&n.FuncType.Params)
+			stack = append(stack, n.FuncType.Return)
+			block(&n.Body)
+		case *ast.TypeDecl:
+			stack = append(stack, n.Type)
+		case *ast.VarDecl:
+			stack = append(stack, n.Type)
+			for _, value := range n.Values {
+				stack = append(stack, value)
+			}
+		case *ast.ReturnStmt:
+			move(&n.ReturnPos)
+			stack = append(stack, n.Type, n.Value)
+		case *ast.DeclStmt:
+			stack = append(stack, n.Decl)
+		case *ast.ExprStmt:
+			stack = append(stack, n.X)
+		case *ast.EmptyStmt:
+			move(&n.SemicolonPos)
+		case *ast.BlockStmt:
+			block(n)
+		case *ast.IdentifierExpr:
+			move(&n.NamePos)
+		case *ast.NumberLitExpr:
+			move(&n.ValuePos)
+			stack = append(stack, n.Type)
+		case *ast.StringLitExpr:
+			move(&n.ValuePos)
+		case *ast.BinaryExpr:
+			move(&n.OpPos)
+			stack = append(stack, n.X, n.Y)
+		case *ast.UnaryExpr:
+			move(&n.OpPos)
+			stack = append(stack, n.X)
+		case *ast.CallExpr:
+			move(&n.OpenParenPos)
+			move(&n.CloseParenPos)
+			stack = append(stack, n.Fn)
+			for _, arg := range n.Args {
+				stack = append(stack, arg)
+			}
+		case *ast.NullExpr:
+			move(&n.Pos)
+			stack = append(stack, n.Type)
+		case *ast.VoidExpr:
+			move(&n.Pos)
+		case *ast.VarRefExpr:
+			move(&n.Pos)
+		case *ast.PrimitiveTypeExpr:
+			move(&n.Pos)
+		case *ast.PointerTypeExpr:
+			move(&n.Pos)
+			stack = append(stack, n.PointerToType)
+		case *ast.InterfaceTypeExpr:
+			move(&n.InterfacePos)
+			move(&n.Methods.Start)
+			move(&n.Methods.End)
+			for i := range n.Methods.Methods {
+				params(&n.Methods.Methods[i].Params)
+				stack = append(stack, n.Methods.Methods[i].Return)
+			}
+		case *ast.StructTypeExpr:
+			move(&n.StructPos)
+			move(&n.Properties.Start)
+			move(&n.Properties.End)
+			for _, property := range n.Properties.Properties {
+				stack = append(stack, property.Type)
+			}
+		}
+	}
+}
+
+// Fill Parser.Nodes and Parser.Errors with the whole file's, moving the positions of any nodes that haven't been yet
+func (inc *Incremental) Collect() {
+	inc.Parser.Nodes = nil
+	inc.Parser.Errors = nil
+	for i := 0; i < inc.Len(); i++ {
+		decl := inc.Decl(i)
+		if decl.Node != nil {
+			inc.Parser.Nodes = append(inc.Parser.Nodes, decl.Node)
+		}
+		inc.Parser.Errors = append(inc.Parser.Errors, decl.Errors...)
+	}
+}
+
+// Whether a and b declare the same types (in any order)
+func SameTypes(a, b []IncrementalDecl) bool {
+	count := map[ast.Symbol]int{}
+	for _, decl := range a {
+		if decl.Type != nil {
+			count[decl.Type.Sym]++
+		}
+	}
+	for _, decl := range b {
+		if decl.Type != nil {
+			count[decl.Type.Sym]--
+		}
+	}
+	for _, n := range count {
+		if n != 0 {
+			return false
+		}
+	}
+	return true
+}
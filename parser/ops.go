@@ -0,0 +1,73 @@
+package parser
+
+import "github.com/IbrahimFadel/pi-lang/ast"
+
+type (
+	// Parses an expression that starts with CurTok
+	PrefixParseFn func(p *Parser) (ast.Expr, error)
+	// Parses the rest of an expression whose left hand side x has already been parsed, CurTok is the operator
+	InfixParseFn func(p *Parser, x ast.Expr) (ast.Expr, error)
+)
+
+/*
+ * Operators ParseExpr keeps on its own stack instead of calling Parse for, so nesting them doesn't nest Go calls
+ * Anything else (OpOther) is parsed by calling its Parse function
+ */
+type OpKind uint8
+
+const (
+	OpOther  OpKind = iota
+	OpUnary         // '-x'
+	OpParen         // '(x)'
+	OpBinary        // 'x + y'
+	OpCall          // 'x(y, z)'
+)
+
+type PrefixOp struct {
+	Kind  OpKind
+	Parse PrefixParseFn // Only for OpOther, nil if no expression starts with the token
+}
+
+type InfixOp struct {
+	Precedence int // 0 if the token isn't an infix operator
+	RightAssoc bool
+	Kind       OpKind
+	Parse      InfixParseFn // Only for OpOther
+}
+
+// Operands of unary operators bind tighter than any binary operator but looser than '.', '->' and calls
+const unaryPrecedence = 45
+
+/*
+ * How expressions are parsed, indexed by the TokenType they start with (PrefixOps) or continue with (InfixOps)
+ * Looking an operator up is an array index, adding one is adding an entry here
+ */
+var (
+	PrefixOps [ast.TokenTypeEOF + 1]PrefixOp
+	InfixOps  [ast.TokenTypeEOF + 1]InfixOp
+)
+
+func init() {
+	PrefixOps[ast.TokenTypeNumberLiteral] = PrefixOp{Parse: func(p *Parser) (ast.Expr, error) { return p.ParseNumberLit() }}
+	PrefixOps[ast.TokenTypeStringLiteral] = PrefixOp{Parse: func(p *Parser) (ast.Expr, error) { return p.ParseStringLit() }}
+	PrefixOps[ast.TokenTypeIdentifier] = PrefixOp{Parse: (*Parser).ParseIdentifier}
+	PrefixOps[ast.TokenTypeOpenParen] = PrefixOp{Kind: OpParen}
+	PrefixOps[ast.TokenTypeMinus] = PrefixOp{Kind: OpUnary}
+	PrefixOps[ast.TokenTypeAmpersand] = PrefixOp{Kind: OpUnary}
+	PrefixOps[ast.TokenTypeAsterisk] = PrefixOp{Kind: OpUnary}
+
+	binary := func(precedence int, rightAssoc bool, tokenTypes ...ast.TokenType) {
+		for _, tokenType := range tokenTypes {
+			InfixOps[tokenType] = InfixOp{Precedence: precedence, RightAssoc: rightAssoc, Kind: OpBinary}
+		}
+	}
+	binary(2, true, ast.TokenTypeEq)
+	binary(3, false, ast.TokenTypeAnd)
+	binary(5, false, ast.TokenTypeOr)
+	binary(10, false, ast.TokenTypeCompareLt, ast.TokenTypeCompareGt, ast.TokenTypeCompareLtEq, ast.TokenTypeCompareGtEq, ast.TokenTypeCompareEq, ast.TokenTypeCompareNe)
+	binary(20, false, ast.TokenTypePlus, ast.TokenTypeMinus)
+	binary(40, false, ast.TokenTypeAsterisk, ast.TokenTypeSlash)
+	binary(50, false, ast.TokenTypePeriod, ast.TokenTypeArrow)
+
+	InfixOps[ast.TokenTypeOpenParen] = InfixOp{Precedence: 60, Kind: OpCall}
+}
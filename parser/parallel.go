@@ -0,0 +1,147 @@
+package parser
+
+import (
+	"runtime"
+	"sync"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/utils"
+)
+
+// Token streams shorter than this aren't worth splitting up
+const minParallelTokens = 16 << 10
+
+// Declarations are grouped into about this many chunks per goroutine so one long function doesn't leave the others idle
+const chunksPerWorker = 4
+
+// A run of whole top level declarations that one goroutine parses on its own
+type declChunk struct {
+	Start, End int // Range in Parser.Tokens
+	Parser     Parser
+}
+
+/*
+ * Parse tokens on several goroutines, Nodes ends up in the same order GenerateAST would give
+ *
+ * The tokens are scanned first to find where every top level declaration starts (a 'fn', 'type' or 'package' outside of braces)
+ * and the name of every type that's declared, so no declaration has to wait on the ones before it to be parsed
+ * A prescanned type can only be used after its declaration, so forward references are still errors like they are in GenerateAST
+ * The declarations are then parsed in chunks on a pool of goroutines, each with its own Parser and a fork of Arena
+ */
+func (p *Parser) GenerateASTParallel(tokens []ast.Token) {
+	p.Init(tokens)
+	workers := runtime.GOMAXPROCS(0)
+	starts := p.PrescanDecls()
+	if len(tokens) < minParallelTokens || len(starts) < 2 || workers < 2 {
+		p.InitTables()
+		p.ParseNodes()
+		return
+	}
+
+	chunks := p.SplitDecls(starts, workers*chunksPerWorker)
+	for i := range chunks {
+		chunk := &chunks[i]
+		chunk.Parser.Init(tokens[chunk.Start:chunk.End:chunk.End])
+		chunk.Parser.TokOffset = chunk.Start
+		chunk.Parser.Arena = p.Arena.Fork()
+		chunk.Parser.KnownIdentifierTypes = p.KnownIdentifierTypes
+		chunk.Parser.KnownTypesFrom = p.KnownTypesFrom
+		chunk.Parser.SharedTypes = true
+		chunk.Parser.LazyBodies = p.LazyBodies
+		chunk.Parser.Recover = true // Errors are reported below in order instead of by whichever goroutine hits one first
+	}
+
+	next := make(chan *declChunk, len(chunks))
+	for i := range chunks {
+		next <- &chunks[i]
+	}
+	close(next)
+
+	var wg sync.WaitGroup
+	for w := 0; w < workers; w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for chunk := range next {
+				chunk.Parser.ParseNodes()
+			}
+		}()
+	}
+	wg.Wait()
+
+	// The prescanned types were only names, swap in the real declarations like a sequential parse would have added them
+	from := p.KnownTypesFrom
+	p.InitTables()
+	for i := range chunks {
+		chunk := &chunks[i].Parser
+		for _, node := range chunk.Nodes {
+			if typeDecl, ok := node.(*ast.TypeDecl); ok {
+				p.addKnownType(typeDecl, from[typeDecl.Sym])
+			}
+		}
+		p.Nodes = append(p.Nodes, chunk.Nodes...)
+		p.Errors = append(p.Errors, chunk.Errors...)
+	}
+	p.TokIndex = len(tokens) - 1
+	p.CurTok = tokens[p.TokIndex]
+
+	if !p.Recover && len(p.Errors) > 0 {
+		utils.FatalError(p.Errors[0].String())
+	}
+}
+
+/*
+ * Find the index in Tokens of every top level declaration and add the types they declare to KnownIdentifierTypes
+ * The types are only stand-ins with a Name and Sym, they're just there so the type's name is known while parsing
+ * Each one can be used from the start of the declaration after it, which is where GenerateAST would have added it
+ */
+func (p *Parser) PrescanDecls() []int {
+	var starts []int
+	depth := 0
+	for i, tok := range p.Tokens {
+		switch tok.TokenType {
+		case ast.TokenTypeOpenCurlyBracket:
+			depth++
+		case ast.TokenTypeCloseCurlyBracket:
+			if depth > 0 {
+				depth--
+			}
+		case ast.TokenTypeFn, ast.TokenTypePackage, ast.TokenTypeType:
+			if depth != 0 {
+				continue
+			}
+			starts = append(starts, i)
+		}
+	}
+
+	for n, start := range starts {
+		if name := p.Tokens[start+1]; p.Tokens[start].TokenType == ast.TokenTypeType && name.TokenType == ast.TokenTypeIdentifier {
+			from := len(p.Tokens) - 1
+			if n+1 < len(starts) {
+				from = starts[n+1]
+			}
+			p.addKnownType(&ast.TypeDecl{Name: name.Value, Sym: name.Sym}, from)
+		}
+	}
+	return starts
+}
+
+// Group the declarations starting at starts into at most n chunks of about the same number of tokens
+func (p *Parser) SplitDecls(starts []int, n int) []declChunk {
+	eof := len(p.Tokens) - 1
+	starts[0] = 0 // Anything before the first declaration goes with it
+	chunks := make([]declChunk, 0, n)
+	size := eof/n + 1
+	chunkStart := 0
+	for i := 1; i <= len(starts); i++ {
+		end := eof
+		if i < len(starts) {
+			end = starts[i]
+		}
+		if end-chunkStart >= size || end == eof {
+			chunks = append(chunks, declChunk{Start: chunkStart, End: end})
+			chunkStart = end
+		}
+	}
+	return chunks
+}
@@ -10,42 +10,68 @@ import (
 type Parser struct {
 	Nodes                []ast.Node
 	Tokens               []ast.Token
+	Lexer                *ast.Lexer // If set, tokens are pulled from here instead of Tokens
+	Arena                *ast.Arena // If set, nodes are allocated here instead of one by one
 	CurTok               ast.Token
 	TokIndex             int
-	OpPrecedence         map[string]int
-	KnownIdentifierTypes map[string]*ast.TypeDecl
+	TokOffset            int             // Index of Tokens[0] in the whole token stream when parsing a slice of it
+	KnownIdentifierTypes []*ast.TypeDecl // Indexed by Symbol
+	KnownTypesFrom       []int           // Indexed by Symbol, the index in the whole token stream a known type can be used from
+	SharedTypes          bool            // KnownIdentifierTypes belongs to another parser and is only read
 	CurType              ast.Expr
 	CurFunc              *ast.FuncDecl
+	Recover              bool         // Collect errors in Errors and carry on instead of exiting on the first one
+	LazyBodies           bool         // Skip function bodies until FuncDecl.ExpandBody, only when parsing from Tokens
+	Errors               []Diagnostic // Only filled when Recover is set
+
+	exprOps      []exprFrame // ParseExpr's stacks, kept between expressions so they're only allocated once
+	exprOperands []ast.Expr
 }
 
 func (p *Parser) Init(tokens []ast.Token) {
 	p.Tokens = tokens
+	p.Lexer = nil
 	p.CurTok = p.Tokens[0]
 	p.TokIndex = 0
-	p.OpPrecedence = map[string]int{
-		"=":  2,
-		"&&": 3,
-		"||": 5,
-		"<":  10,
-		">":  10,
-		"<=": 10,
-		">=": 10,
-		"==": 10,
-		"!=": 10,
-		"+":  20,
-		"-":  20,
-		"*":  40,
-		"/":  40,
-		".":  50,
-		"->": 50,
-	}
-	p.KnownIdentifierTypes = make(map[string]*ast.TypeDecl)
+	p.InitTables()
+}
+
+func (p *Parser) InitLexer(lexer *ast.Lexer) {
+	p.Tokens = nil
+	p.Lexer = lexer
+	p.CurTok = lexer.NextToken()
+	p.TokIndex = 0
+	p.InitTables()
+}
+
+func (p *Parser) InitTables() {
+	p.KnownIdentifierTypes = nil
+	p.KnownTypesFrom = nil
 }
 
 func (p *Parser) GenerateAST(tokens []ast.Token) {
 	p.Init(tokens)
+	p.ParseNodes()
+}
 
+/*
+ * Parse straight from a lexer that has been Reset to its source
+ * Tokens are lexed as the parser needs them, so they never all exist at once
+ */
+func (p *Parser) GenerateASTFromLexer(lexer *ast.Lexer) {
+	p.InitLexer(lexer)
+	p.ParseNodes()
+}
+
+func (p *Parser) ParseNodes() {
 	for p.CurTok.TokenType != ast.TokenTypeEOF {
+		if p.Recover {
+			if node, ok := p.ParseDeclRecovering(); ok {
+				p.Nodes = append(p.Nodes, node)
+			}
+			continue
+		}
+
 		node, err := p.ParseToken(p.CurTok)
 		if err != nil {
 			utils.FatalError(err.Error())
@@ -55,30 +81,71 @@ func (p *Parser) GenerateAST(tokens []ast.Token) {
 }
 
 func (p *Parser) EatToken() {
+	if p.CurTok.TokenType == ast.TokenTypeEOF {
+		return
+	}
 	p.TokIndex++
-	p.CurTok = p.Tokens[p.TokIndex]
+	if p.Lexer != nil {
+		p.CurTok = p.Lexer.NextToken()
+		return
+	}
+	if p.TokIndex < len(p.Tokens) {
+		p.CurTok = p.Tokens[p.TokIndex]
+	} else {
+		// Tokens can be a slice of a longer stream that doesn't end in EOF
+		p.CurTok = ast.Token{TokenType: ast.TokenTypeEOF, Value: "EOF", Pos: ast.TokenPos{Row: -1, Col: -1}}
+	}
 }
 
 /*
  * Expect the CurTok to be of type
- * If not, throw FatalError
+ * If not, report an Error
  */
 func (p *Parser) Expect(tokType ast.TokenType, msg string) {
 	if p.CurTok.TokenType != tokType {
-		utils.FatalError(fmt.Sprintf(msg+" at pos: %v", p.CurTok.Pos))
+		p.Error(p.CurTok.Pos, msg)
+	}
+}
+
+// Get the type declared with the name sym, or nil if there isn't one or it's declared after CurTok
+func (p *Parser) KnownType(sym ast.Symbol) *ast.TypeDecl {
+	if int(sym) < len(p.KnownIdentifierTypes) && p.TokOffset+p.TokIndex >= p.KnownTypesFrom[sym] {
+		return p.KnownIdentifierTypes[sym]
+	}
+	return nil
+}
+
+// Add a type that's just been declared, it can be used from CurTok on
+func (p *Parser) AddKnownType(typeDecl *ast.TypeDecl) {
+	p.addKnownType(typeDecl, p.TokOffset+p.TokIndex)
+}
+
+// A type declared again keeps the from of its first declaration, like a sequential parse would
+func (p *Parser) addKnownType(typeDecl *ast.TypeDecl, from int) {
+	if p.SharedTypes {
+		return
+	}
+	for int(typeDecl.Sym) >= len(p.KnownIdentifierTypes) {
+		p.KnownIdentifierTypes = append(p.KnownIdentifierTypes, nil)
+		p.KnownTypesFrom = append(p.KnownTypesFrom, 0)
+	}
+	if p.KnownIdentifierTypes[typeDecl.Sym] == nil {
+		p.KnownTypesFrom[typeDecl.Sym] = from
 	}
+	p.KnownIdentifierTypes[typeDecl.Sym] = typeDecl
 }
 
+// Precedence of tok as an infix operator, or -1 if it isn't one
 func (p *Parser) TokenPrecedence(tok ast.Token) int {
-	precedence := p.OpPrecedence[tok.Value]
-	if precedence <= 0 {
-		return -1
+	if precedence := InfixOps[tok.TokenType].Precedence; precedence > 0 {
+		return precedence
 	}
-	return precedence
+	return -1
 }
 
 func (p *Parser) ParseToken(token ast.Token) (ast.Node, error) {
 	var node ast.Node
+	p.CurType = nil // A declaration's number literals can't take their type from the one before it
 
 	switch token.TokenType {
 	default:
@@ -98,8 +165,8 @@ func (p *Parser) ParseType() (ast.Expr, error) {
 
 	// TODO: should i refactor this to a seperate function?
 	if p.CurTok.TokenType == ast.TokenTypeIdentifier {
-		if _, ok := p.KnownIdentifierTypes[p.CurTok.Value]; ok {
-			ty := ast.IdentifierExpr{Name: p.CurTok.Value, NamePos: p.CurTok.Pos}
+		if p.KnownType(p.CurTok.Sym) != nil {
+			ty := p.Arena.NewIdentifierExpr(ast.IdentifierExpr{Name: p.CurTok.Value, Sym: p.CurTok.Sym, NamePos: p.CurTok.Pos})
 			p.EatToken()
 			if p.CurTok.TokenType != ast.TokenTypeAsterisk {
 				p.CurType = ty
@@ -107,11 +174,10 @@ func (p *Parser) ParseType() (ast.Expr, error) {
 				return ty, nil
 			}
 
-			pointerType := ast.PointerTypeExpr{PointerToType: ty, Pos: p.CurTok.Pos}
+			pointerType := p.Arena.NewPointerTypeExpr(ast.PointerTypeExpr{PointerToType: ty, Pos: p.CurTok.Pos})
 			p.EatToken()
 			for p.CurTok.TokenType == ast.TokenTypeAsterisk {
-				pointerType.PointerToType = pointerType
-				pointerType.Pos = p.CurTok.Pos
+				pointerType = p.Arena.NewPointerTypeExpr(ast.PointerTypeExpr{PointerToType: pointerType, Pos: p.CurTok.Pos})
 				p.EatToken()
 			}
 			p.CurType = pointerType
@@ -121,14 +187,14 @@ func (p *Parser) ParseType() (ast.Expr, error) {
 
 	switch p.CurTok.TokenType {
 	default:
-		return ast.EmptyExpr{}, fmt.Errorf("could not parse type: %s", p.CurTok.Value)
+		return &ast.EmptyExpr{}, fmt.Errorf("could not parse type: %s", p.CurTok.Value)
 	case ast.TokenTypeI64, ast.TokenTypeU64, ast.TokenTypeI32, ast.TokenTypeU32, ast.TokenTypeI16, ast.TokenTypeU16, ast.TokenTypeI8, ast.TokenTypeU8, ast.TokenTypeF64, ast.TokenTypeF32, ast.TokenTypeBool, ast.TokenTypeString:
 		ty := p.ParsePrimitiveType()
 		p.CurType = ty
 		return ty, nil
 	case ast.TokenTypeVoid:
 		p.EatToken()
-		return ast.VoidExpr{}, nil
+		return p.Arena.NewVoidExpr(ast.VoidExpr{}), nil
 	case ast.TokenTypeInterface:
 		interfaceTy, err := p.ParseInterfaceType()
 		if err != nil {
@@ -146,8 +212,8 @@ func (p *Parser) ParseType() (ast.Expr, error) {
 	}
 }
 
-func (p *Parser) ParseStructType() (ast.StructTypeExpr, error) {
-	var structType ast.StructTypeExpr
+func (p *Parser) ParseStructType() (*ast.StructTypeExpr, error) {
+	structType := p.Arena.NewStructTypeExpr(ast.StructTypeExpr{})
 
 	structPos := p.CurTok.Pos
 	p.EatToken()
@@ -205,14 +271,14 @@ func (p *Parser) ParseProperty() (ast.Property, error) {
 	}
 	property.Type = propertyType
 
-	names := p.ParseIdentList()
+	names, _ := p.ParseIdentList()
 	property.Names = names
 
 	return property, nil
 }
 
-func (p *Parser) ParseInterfaceType() (ast.InterfaceTypeExpr, error) {
-	var interfaceType ast.InterfaceTypeExpr
+func (p *Parser) ParseInterfaceType() (*ast.InterfaceTypeExpr, error) {
+	interfaceType := p.Arena.NewInterfaceTypeExpr(ast.InterfaceTypeExpr{})
 	interfaceType.InterfacePos = p.CurTok.Pos
 	p.EatToken()
 
@@ -250,6 +316,7 @@ func (p *Parser) ParseMethod() (ast.Method, error) {
 	var method ast.Method
 	p.Expect(ast.TokenTypeIdentifier, "expected identifier in method declaration")
 	method.Name = p.CurTok.Value
+	method.Sym = p.CurTok.Sym
 	p.EatToken()
 
 	p.Expect(ast.TokenTypeOpenParen, "expected '(' before parameter list in method declaration")
@@ -261,7 +328,7 @@ func (p *Parser) ParseMethod() (ast.Method, error) {
 	}
 	method.Params = params
 
-	method.Return = ast.VoidExpr{Pos: p.CurTok.Pos}
+	method.Return = p.Arena.NewVoidExpr(ast.VoidExpr{Pos: p.CurTok.Pos})
 	if p.CurTok.TokenType == ast.TokenTypeArrow {
 		p.EatToken()
 		retType, err := p.ParseType()
@@ -274,29 +341,26 @@ func (p *Parser) ParseMethod() (ast.Method, error) {
 }
 
 func (p *Parser) ParsePrimitiveType() ast.Expr {
-	var primitiveType ast.PrimitiveTypeExpr
-	primitiveType.PrimitiveType = p.CurTok.TokenType
-	primitiveType.Pos = p.CurTok.Pos
+	primitiveType := p.Arena.NewPrimitiveTypeExpr(ast.PrimitiveTypeExpr{PrimitiveType: p.CurTok.TokenType, Pos: p.CurTok.Pos})
 	p.EatToken()
 
 	if p.CurTok.TokenType != ast.TokenTypeAsterisk {
 		return primitiveType
 	}
 
-	pointerType := ast.PointerTypeExpr{PointerToType: primitiveType, Pos: primitiveType.Pos}
+	pointerType := p.Arena.NewPointerTypeExpr(ast.PointerTypeExpr{PointerToType: primitiveType, Pos: primitiveType.Pos})
 	p.EatToken()
 	for p.CurTok.TokenType == ast.TokenTypeAsterisk {
-		pointerType.PointerToType = pointerType
-		pointerType.Pos = p.CurTok.Pos
+		pointerType = p.Arena.NewPointerTypeExpr(ast.PointerTypeExpr{PointerToType: pointerType, Pos: p.CurTok.Pos})
 		p.EatToken()
 	}
 	return pointerType
 }
 
-func (p *Parser) ParsePackageClause() (ast.PackageClause, error) {
+func (p *Parser) ParsePackageClause() (*ast.PackageClause, error) {
 	p.EatToken()
 	p.Expect(ast.TokenTypeIdentifier, "expected identifier following 'package'")
 	name := p.CurTok.Value
 	p.EatToken()
-	return ast.PackageClause{Name: name}, nil
+	return p.Arena.NewPackageClause(ast.PackageClause{Name: name}), nil
 }
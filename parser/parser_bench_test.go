@@ -0,0 +1,153 @@
+package parser_test
+
+import (
+	"fmt"
+	"runtime"
+	"strings"
+	"testing"
+	"time"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/parser"
+)
+
+/*
+ * Shapes of generated source, each one grows a different dimension of the AST with n
+ * Per token costs that go up with n mean the parser scales worse than linearly in that dimension
+ */
+var sourceShapes = []struct {
+	Name   string
+	Source func(src *strings.Builder, n int)
+}{
+	{"small-fns", smallFns},
+	{"long-fn", longFn},
+	{"nested-expr", nestedExpr},
+	{"wide-struct", wideStruct},
+	{"interface-methods", interfaceMethods},
+}
+
+var sourceSizes = []int{1 << 10, 1 << 13, 1 << 16}
+
+// n functions with one statement each
+func smallFns(src *strings.Builder, n int) {
+	for i := 0; i < n; i++ {
+		fmt.Fprintf(src, "fn fun%d(i32 a) -> i32 {\n\treturn a\n}\n\n", i)
+	}
+}
+
+// One function with n statements
+func longFn(src *strings.Builder, n int) {
+	src.WriteString("fn long(i32 a) -> i32 {\n")
+	for i := 0; i < n; i++ {
+		fmt.Fprintf(src, "\tconst i32 x%d = a + %d * 2\n", i, i)
+	}
+	src.WriteString("\treturn a\n}\n")
+}
+
+// An expression nested n parentheses deep
+func nestedExpr(src *strings.Builder, n int) {
+	src.WriteString("fn nested(i32 a) -> i32 {\n\tconst i32 x = ")
+	src.WriteString(strings.Repeat("(", n))
+	src.WriteString("a")
+	src.WriteString(strings.Repeat(" + 1)", n))
+	src.WriteString("\n\treturn x\n}\n")
+}
+
+// A struct with n fields
+func wideStruct(src *strings.Builder, n int) {
+	src.WriteString("type Wide struct {\n")
+	for i := 0; i < n; i++ {
+		fmt.Fprintf(src, "\tpub mut i32 field%d\n", i)
+	}
+	src.WriteString("}\n")
+}
+
+// An interface with n methods
+func interfaceMethods(src *strings.Builder, n int) {
+	src.WriteString("type Big interface {\n")
+	for i := 0; i < n; i++ {
+		fmt.Fprintf(src, "\tmethod%d(i32 a, f64 b) -> i32\n", i)
+	}
+	src.WriteString("}\n")
+}
+
+// Tokens of a generated source, tokens aren't what's being measured so they're made up front
+func sourceTokens(shape, n int) []ast.Token {
+	var src strings.Builder
+	sourceShapes[shape].Source(&src, n)
+	var lexer ast.Lexer
+	lexer.TokenizeBuffer([]byte(src.String()))
+	lexer.FillTokens()
+	return lexer.Tokens
+}
+
+// Run bench over every shape and size, reporting ns/token and allocs/token
+func benchmarkShapes(b *testing.B, bench func(tokens []ast.Token)) {
+	for shape := range sourceShapes {
+		for _, n := range sourceSizes {
+			b.Run(fmt.Sprintf("%s/%d", sourceShapes[shape].Name, n), func(b *testing.B) {
+				tokens := sourceTokens(shape, n)
+				b.ReportAllocs()
+				var before, after runtime.MemStats
+				runtime.ReadMemStats(&before)
+				b.ResetTimer()
+				start := time.Now()
+				for i := 0; i < b.N; i++ {
+					bench(tokens)
+				}
+				elapsed := time.Since(start)
+				b.StopTimer()
+				runtime.ReadMemStats(&after)
+
+				total := float64(b.N) * float64(len(tokens))
+				b.ReportMetric(float64(elapsed.Nanoseconds())/total, "ns/token")
+				b.ReportMetric(float64(after.Mallocs-before.Mallocs)/total, "allocs/token")
+			})
+		}
+	}
+}
+
+func BenchmarkGenerateAST(b *testing.B) {
+	benchmarkShapes(b, func(tokens []ast.Token) {
+		var p parser.Parser
+		p.GenerateAST(tokens)
+	})
+}
+
+func BenchmarkGenerateASTArena(b *testing.B) {
+	var arena ast.Arena
+	benchmarkShapes(b, func(tokens []ast.Token) {
+		var p parser.Parser
+		p.Arena = &arena
+		p.GenerateAST(tokens)
+		arena.Reset()
+	})
+}
+
+/*
+ * Insert a line near the top of files of more and more functions and take it out again, one Reparse per op
+ * Only the edited function is parsed again, so ns/op should stay about the same as the file grows
+ * The first edit moves the gaps from the end of the file to the top, after that only what's between two edits moves
+ */
+func BenchmarkIncrementalReparse(b *testing.B) {
+	for _, n := range []int{1 << 10, 1 << 13, 1 << 16} {
+		b.Run(fmt.Sprint(n), func(b *testing.B) {
+			src := GenerateSource(n)
+			at := strings.Index(string(src), "return x\n}\n\nfn fun3")
+			insert := parser.Edit{Start: at, End: at, Text: []byte("\n")}
+			remove := parser.Edit{Start: at, End: at + 1}
+
+			var inc parser.Incremental
+			inc.Parse(src)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if i%2 == 0 {
+					inc.Reparse(insert)
+				} else {
+					inc.Reparse(remove)
+				}
+			}
+		})
+	}
+}
@@ -1 +1,586 @@
 package parser_test
+
+import (
+	"fmt"
+	"io/ioutil"
+	"math/rand"
+	"reflect"
+	"runtime"
+	"runtime/debug"
+	"strings"
+	"testing"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/parser"
+)
+
+func GenerateSource(fns int) []byte {
+	var src strings.Builder
+	src.WriteString("type Point struct {\n\tpub mut i32 X, Y\n\tconst i64* Z\n}\n\n")
+	for i := 0; i < fns; i++ {
+		fmt.Fprintf(&src, "fn fun%d(i32 a, mut Point* p) -> i32 {\n\tconst i32 x = a + %d * 2\n\tmut Point* q\n\treturn x\n}\n\n", i, i)
+	}
+	return []byte(src.String())
+}
+
+func Parse(src []byte, arena *ast.Arena) []ast.Node {
+	var lexer ast.Lexer
+	lexer.Reset(src)
+	var p parser.Parser
+	p.Arena = arena
+	p.GenerateASTFromLexer(&lexer)
+	return p.Nodes
+}
+
+func TestArenaMatchesHeap(t *testing.T) {
+	src := GenerateSource(100)
+	var arena ast.Arena
+	heapNodes := Parse(src, nil)
+	arenaNodes := Parse(src, &arena)
+	if !reflect.DeepEqual(heapNodes, arenaNodes) {
+		t.Errorf("Expected the AST allocated in an arena to be the same as the one allocated on the heap")
+	}
+
+	heapAllocs := testing.AllocsPerRun(5, func() { Parse(src, nil) })
+	arenaAllocs := testing.AllocsPerRun(5, func() {
+		Parse(src, &arena)
+		arena.Reset()
+	})
+	if arenaAllocs >= heapAllocs {
+		t.Errorf("Expected parsing into an arena to allocate less than %.0f times but it allocated %.0f times", heapAllocs, arenaAllocs)
+	}
+}
+
+// Write x out fully parenthesized
+func Sexpr(x ast.Expr) string {
+	switch e := x.(type) {
+	case *ast.BinaryExpr:
+		return fmt.Sprintf("(%s %d %s)", Sexpr(e.X), e.Op, Sexpr(e.Y))
+	case *ast.UnaryExpr:
+		return fmt.Sprintf("(%d %s)", e.Op, Sexpr(e.X))
+	case *ast.CallExpr:
+		args := make([]string, len(e.Args))
+		for i, arg := range e.Args {
+			args[i] = Sexpr(arg)
+		}
+		return fmt.Sprintf("%s(%s)", Sexpr(e.Fn), strings.Join(args, ", "))
+	case *ast.VarRefExpr:
+		return e.Name
+	case *ast.NumberLitExpr:
+		return e.Value
+	}
+	return fmt.Sprintf("%T", x)
+}
+
+func TestOperatorPrecedence(t *testing.T) {
+	tests := map[string]string{
+		"a + b * c":       fmt.Sprintf("(a %d (b %d c))", ast.TokenTypePlus, ast.TokenTypeAsterisk),
+		"a - b - c":       fmt.Sprintf("((a %d b) %d c)", ast.TokenTypeMinus, ast.TokenTypeMinus),
+		"a = b = c":       fmt.Sprintf("(a %d (b %d c))", ast.TokenTypeEq, ast.TokenTypeEq),
+		"(a + b) * c":     fmt.Sprintf("((a %d b) %d c)", ast.TokenTypePlus, ast.TokenTypeAsterisk),
+		"-a.b + *c":       fmt.Sprintf("((%d (a %d b)) %d (%d c))", ast.TokenTypeMinus, ast.TokenTypePeriod, ast.TokenTypePlus, ast.TokenTypeAsterisk),
+		"a + f(1, b < 2)": fmt.Sprintf("(a %d f(1, (b %d 2)))", ast.TokenTypePlus, ast.TokenTypeCompareLt),
+		"a && b == 1":     fmt.Sprintf("(a %d (b %d 1))", ast.TokenTypeAnd, ast.TokenTypeCompareEq),
+	}
+	for src, expected := range tests {
+		var lexer ast.Lexer
+		lexer.Reset([]byte(src))
+		var p parser.Parser
+		p.InitLexer(&lexer)
+		x, err := p.ParseExpr()
+		if err != nil {
+			t.Errorf("Could not parse '%s': %s", src, err.Error())
+		} else if got := Sexpr(x); got != expected {
+			t.Errorf("Expected '%s' to parse as %s but got %s", src, expected, got)
+		}
+	}
+}
+
+func TestIterativeExprMatchesRecursive(t *testing.T) {
+	srcs := []string{
+		"a + b * c - d / e",
+		"a = b = c && d || e < f",
+		"-a.b(c, d)(e) * (f + g)",
+		"&*x->y.z",
+		"((a)) + ((b + c) * d)",
+		"f(g(h(1, 2), \"s\"), -i, j = k,)",
+		"f() + g()()",
+	}
+	for _, src := range srcs {
+		var exprs [2]ast.Expr
+		for i := range exprs {
+			var lexer ast.Lexer
+			lexer.Reset([]byte(src))
+			var p parser.Parser
+			p.InitLexer(&lexer)
+			var err error
+			if i == 0 {
+				exprs[i], err = p.ParseExpr()
+			} else {
+				exprs[i], err = p.ParseBinaryExpr(1)
+			}
+			if err != nil {
+				t.Fatalf("Could not parse '%s': %s", src, err.Error())
+			}
+		}
+		if !reflect.DeepEqual(exprs[0], exprs[1]) {
+			t.Errorf("Expected '%s' to parse the same as it does recursively but got %s and %s", src, Sexpr(exprs[0]), Sexpr(exprs[1]))
+		}
+	}
+}
+
+func TestExprStacksEmptyAfterBailout(t *testing.T) {
+	var lexer ast.Lexer
+	lexer.Reset([]byte("fn f() -> i32 {\n\tconst i32 x = g(1, (2 + 3\n\treturn x\n}\n"))
+	var p parser.Parser
+	p.Recover = true
+	p.GenerateASTFromLexer(&lexer)
+
+	if len(p.Errors) == 0 {
+		t.Fatalf("Expected an error for the unclosed call")
+	}
+	if ops, operands := p.ExprStackDepth(); ops != 0 || operands != 0 {
+		t.Errorf("Expected the expression stacks to be empty after bailing out but %d frames and %d operands were left", ops, operands)
+	}
+}
+
+func TestHugeExpr(t *testing.T) {
+	// Far less stack than recursing once per term would need, for parsing and for flattening
+	defer debug.SetMaxStack(debug.SetMaxStack(1 << 20))
+
+	const n = 1 << 18
+	tests := []struct {
+		Src   string
+		Depth int  // Of the chain of operands from the root
+		Right bool // Whether the chain goes down binary expressions' right hand sides
+	}{
+		{strings.Repeat("(", n) + "a" + strings.Repeat(" + 1)", n), n, false},
+		{strings.Repeat("a = ", n) + "a", n, true},
+		{strings.Repeat("-", n) + "a" + strings.Repeat(" * a", n), 2 * n, false},
+		{strings.Repeat("f(", n) + "a" + strings.Repeat(", 1)", n), n, false},
+	}
+	for _, test := range tests {
+		var lexer ast.Lexer
+		lexer.Reset([]byte(test.Src))
+		var p parser.Parser
+		p.InitLexer(&lexer)
+		x, err := p.ParseExpr()
+		if err != nil {
+			t.Fatalf("Could not parse %s...: %s", test.Src[:16], err.Error())
+		}
+
+		// Flattening it for the cache and building it back up can't recurse per term either
+		var flat ast.FlatAST
+		if err := flat.Flatten([]ast.Node{x}); err != nil {
+			t.Fatal(err)
+		}
+		inflated, err := flat.Inflate(nil)
+		if err != nil {
+			t.Fatal(err)
+		}
+		x = inflated[0]
+
+		depth := 0
+		for ; ; depth++ {
+			if e, ok := x.(*ast.BinaryExpr); ok && test.Right {
+				x = e.Y
+			} else if ok {
+				x = e.X
+			} else if e, ok := x.(*ast.UnaryExpr); ok {
+				x = e.X
+			} else if e, ok := x.(*ast.CallExpr); ok {
+				x = e.Args[0]
+			} else {
+				break
+			}
+		}
+		if depth != test.Depth {
+			t.Errorf("Expected %s... to be %d deep but it's %d", test.Src[:16], test.Depth, depth)
+		}
+	}
+}
+
+func TestRecoverCollectsEveryError(t *testing.T) {
+	src := `
+fn broken( -> i32 {
+	return 0
+}
+
+fn fine() -> i32 {
+	const i32 x = 1
+	mut = 2
+	const i32 y = )
+	return x
+}
+
+type T struct { 5 }
+
+fn alsoFine() {
+}
+`
+	var lexer ast.Lexer
+	lexer.Reset([]byte(src))
+	var p parser.Parser
+	p.Recover = true
+	p.GenerateASTFromLexer(&lexer)
+
+	expectedRows := []int{2, 8, 9, 13}
+	if len(p.Errors) != len(expectedRows) {
+		t.Fatalf("Expected %d errors but got %d: %v", len(expectedRows), len(p.Errors), p.Errors)
+	}
+	for i, diag := range p.Errors {
+		if diag.Pos.Row != expectedRows[i] {
+			t.Errorf("Expected error %d to be on row %d but got %s", i, expectedRows[i], diag)
+		}
+	}
+
+	if len(p.Nodes) != 2 {
+		t.Fatalf("Expected the 2 functions without errors in them to be parsed but got %d nodes", len(p.Nodes))
+	}
+	fine := p.Nodes[0].(*ast.FuncDecl)
+	if fine.Name != "fine" || len(fine.Body.List) != 2 {
+		t.Errorf("Expected 'fine' to keep its 2 good statements but got '%s' with %d", fine.Name, len(fine.Body.List))
+	}
+}
+
+func TestParallelMatchesSequential(t *testing.T) {
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	src := append(GenerateSource(1000), "fn broken( {\n}\n\nfn alsoBroken() -> {\n}\n"...)
+	var lexer ast.Lexer
+	lexer.TokenizeBuffer(src)
+	lexer.FillTokens()
+
+	var sequential, parallel parser.Parser
+	sequential.Recover = true
+	sequential.GenerateAST(lexer.Tokens)
+	parallel.Recover = true
+	parallel.GenerateASTParallel(lexer.Tokens)
+
+	if !reflect.DeepEqual(sequential.Nodes, parallel.Nodes) {
+		t.Errorf("Expected parsing in parallel to give the same AST as parsing sequentially")
+	}
+	if !reflect.DeepEqual(sequential.Errors, parallel.Errors) {
+		t.Errorf("Expected errors %v when parsing in parallel but got %v", sequential.Errors, parallel.Errors)
+	}
+	if len(parallel.Errors) != 2 {
+		t.Errorf("Expected 2 errors but got %d: %v", len(parallel.Errors), parallel.Errors)
+	}
+}
+
+func TestParallelForwardTypeReference(t *testing.T) {
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(4))
+	src := append([]byte("fn early(Later* l) {\n}\n\n"), GenerateSource(1000)...)
+	src = append(src, "type Later struct {\n\tconst i32 X\n}\n\nfn late(Later* l) {\n}\n"...)
+	var lexer ast.Lexer
+	lexer.TokenizeBuffer(src)
+	lexer.FillTokens()
+
+	var sequential, parallel parser.Parser
+	sequential.Recover = true
+	sequential.GenerateAST(lexer.Tokens)
+	parallel.Recover = true
+	parallel.GenerateASTParallel(lexer.Tokens)
+
+	if len(sequential.Errors) != 1 || sequential.Errors[0].Pos.Row != 1 {
+		t.Fatalf("Expected an error for using 'Later' before it's declared but got %v", sequential.Errors)
+	}
+	if !reflect.DeepEqual(sequential.Errors, parallel.Errors) {
+		t.Errorf("Expected errors %v when parsing in parallel but got %v", sequential.Errors, parallel.Errors)
+	}
+	if !reflect.DeepEqual(sequential.Nodes, parallel.Nodes) {
+		t.Errorf("Expected parsing in parallel to give the same AST as parsing sequentially")
+	}
+}
+
+func TestLazyBodiesMatchEager(t *testing.T) {
+	src := append(GenerateSource(50), "fn nested() {\n\tconst i32 x = 1\n}\n"...)
+	var lexer ast.Lexer
+	lexer.TokenizeBuffer(src)
+	lexer.FillTokens()
+
+	var eager, lazy parser.Parser
+	eager.GenerateAST(lexer.Tokens)
+	lazy.LazyBodies = true
+	lazy.GenerateAST(lexer.Tokens)
+
+	for _, node := range lazy.Nodes {
+		fn, ok := node.(*ast.FuncDecl)
+		if !ok {
+			continue
+		}
+		if fn.Lazy == nil || len(fn.Body.List) != 0 {
+			t.Fatalf("Expected the body of '%s' to be skipped", fn.Name)
+		}
+		if err := fn.ExpandBody(); err != nil {
+			t.Fatalf("Could not expand the body of '%s': %s", fn.Name, err.Error())
+		}
+	}
+	if !reflect.DeepEqual(eager.Nodes, lazy.Nodes) {
+		t.Errorf("Expected expanded bodies to be the same as bodies parsed up front")
+	}
+}
+
+func TestLazyBodyErrors(t *testing.T) {
+	var lexer ast.Lexer
+	lexer.TokenizeBuffer([]byte("fn f() -> i32 {\n\treturn )\n}\n\nfn g() {\n"))
+	lexer.FillTokens()
+
+	var p parser.Parser
+	p.Recover = true
+	p.LazyBodies = true
+	p.GenerateAST(lexer.Tokens)
+	if len(p.Nodes) != 1 || len(p.Errors) != 1 {
+		t.Fatalf("Expected 1 node and an error for the unterminated body but got %d and %v", len(p.Nodes), p.Errors)
+	}
+	err := p.Nodes[0].(*ast.FuncDecl).ExpandBody()
+	if len(p.Errors) != 2 || p.Errors[1].Pos.Row != 2 {
+		t.Errorf("Expected expanding a bad body to add an error on row 2 but got %v", p.Errors)
+	}
+	if diags, ok := err.(parser.Diagnostics); !ok || len(diags) != 1 || diags[0] != p.Errors[1] {
+		t.Errorf("Expected expanding a bad body to return its error but got %v", err)
+	}
+}
+
+func TestLazyBodyForwardTypeReference(t *testing.T) {
+	var lexer ast.Lexer
+	lexer.TokenizeBuffer([]byte("fn f() {\n\tmut Later* l\n}\n\ntype Later struct {\n\tconst i32 X\n}\n"))
+	lexer.FillTokens()
+
+	var eager, lazy parser.Parser
+	eager.Recover = true
+	eager.GenerateAST(lexer.Tokens)
+	lazy.Recover = true
+	lazy.LazyBodies = true
+	lazy.GenerateAST(lexer.Tokens)
+
+	if len(eager.Errors) != 1 || eager.Errors[0].Pos.Row != 2 {
+		t.Fatalf("Expected an error for using 'Later' before it's declared but got %v", eager.Errors)
+	}
+	if err := lazy.Nodes[0].(*ast.FuncDecl).ExpandBody(); err == nil {
+		t.Fatalf("Expected expanding the body after 'Later' was declared to still fail")
+	}
+	if !reflect.DeepEqual(eager.Errors, lazy.Errors) {
+		t.Errorf("Expected errors %v from the lazy body but got %v", eager.Errors, lazy.Errors)
+	}
+}
+
+func TestIncrementalReparse(t *testing.T) {
+	src := string(GenerateSource(20)) + "type Later i32\n"
+	tests := []struct {
+		name string
+		edit func(src string) parser.Edit
+	}{
+		{"change a literal", func(src string) parser.Edit {
+			at := strings.Index(src, "a + 7 * 2") + 4
+			return parser.Edit{Start: at, End: at + 1, Text: []byte("70")}
+		}},
+		{"unbalance braces", func(src string) parser.Edit {
+			at := strings.Index(src, "return x\n}\n\nfn fun12") + len("return x\n")
+			return parser.Edit{Start: at, End: at + 1}
+		}},
+		{"open a comment", func(src string) parser.Edit {
+			at := strings.Index(src, "fn fun15")
+			return parser.Edit{Start: at, End: at, Text: []byte("/*")}
+		}},
+		{"insert a line", func(src string) parser.Edit {
+			at := strings.Index(src, "a + 7 * 2")
+			return parser.Edit{Start: at, End: at, Text: []byte("\n")}
+		}},
+		{"join two lines", func(src string) parser.Edit {
+			at := strings.Index(src, "\n\nfn fun12")
+			return parser.Edit{Start: at, End: at + 2, Text: []byte(" ")}
+		}},
+		{"declare a type", func(src string) parser.Edit {
+			at := strings.Index(src, "fn fun3")
+			return parser.Edit{Start: at, End: at, Text: []byte("type q i32 ")}
+		}},
+		{"use a type before it's declared", func(src string) parser.Edit {
+			at := strings.Index(src, "fn fun3")
+			at += strings.Index(src[at:], "Point* q")
+			return parser.Edit{Start: at, End: at + len("Point"), Text: []byte("Later")}
+		}},
+	}
+
+	for _, test := range tests {
+		var inc parser.Incremental
+		inc.Parse([]byte(src))
+		inc.Collect()
+		old := inc.Parser.Nodes
+
+		edit := test.edit(src)
+		inc.Reparse(edit)
+		inc.Collect()
+		newSrc := src[:edit.Start] + string(edit.Text) + src[edit.End:]
+
+		var fresh parser.Incremental
+		fresh.Lexer.Symbols = inc.Lexer.Symbols
+		fresh.Parse([]byte(newSrc))
+		fresh.Collect()
+		if !reflect.DeepEqual(inc.Parser.Nodes, fresh.Parser.Nodes) || !reflect.DeepEqual(inc.Parser.Errors, fresh.Parser.Errors) {
+			t.Errorf("%s: expected reparsing to give the same nodes and errors as parsing from scratch, got %v instead of %v", test.name, inc.Parser.Errors, fresh.Parser.Errors)
+		}
+
+		// The same rules as a parse of the whole file, types are only known after they're declared
+		whole := parseWhole(newSrc, inc.Lexer.Symbols)
+		if !reflect.DeepEqual(inc.Parser.Nodes, whole.Nodes) || !reflect.DeepEqual(inc.Parser.Errors, whole.Errors) {
+			t.Errorf("%s: expected reparsing to give the same nodes and errors as GenerateAST, got %v instead of %v", test.name, inc.Parser.Errors, whole.Errors)
+		}
+		if test.name == "use a type before it's declared" && len(inc.Parser.Errors) == 0 {
+			t.Errorf("Expected an error using Later before its declaration")
+		}
+
+		if string(inc.Source()) != newSrc {
+			t.Errorf("%s: expected the edited source to be %q but it's %q", test.name, newSrc, inc.Source())
+		}
+		if inc.Len() != fresh.Len() {
+			t.Errorf("%s: expected %d declarations but got %d", test.name, fresh.Len(), inc.Len())
+			continue
+		}
+		for i := 0; i < fresh.Len(); i++ {
+			decl, got := fresh.Decl(i), inc.Decl(i)
+			if decl.Start != got.Start || decl.End != got.End || decl.Line != got.Line || decl.Col != got.Col {
+				t.Errorf("%s: expected declaration %d to cover %d to %d from %d:%d but it covers %d to %d from %d:%d", test.name, i, decl.Start, decl.End, decl.Line, decl.Col, got.Start, got.End, got.Line, got.Col)
+				break
+			}
+		}
+
+		if test.name == "change a literal" {
+			changed := 0
+			for i := range old {
+				if old[i] != inc.Parser.Nodes[i] {
+					changed++
+				}
+			}
+			if changed != 1 {
+				t.Errorf("Expected only the edited function to be parsed again but %d nodes changed", changed)
+			}
+		}
+	}
+}
+
+// Parse src the way GenerateAST does, recovering from errors
+func parseWhole(src string, symbols *ast.Interner) parser.Parser {
+	var lexer ast.Lexer
+	lexer.Symbols = symbols
+	lexer.Reset([]byte(src))
+	p := parser.Parser{Recover: true}
+	p.GenerateASTFromLexer(&lexer)
+	return p
+}
+
+/*
+ * Lots of small edits one after the other, with the nodes only read every so often
+ * Kept nodes are moved by every edit before they're read at once, that has to come out the same as moving them each time
+ * The source is long enough that an opened comment has to be lexed past the first stretch after the edit
+ */
+func TestIncrementalEdits(t *testing.T) {
+	src := string(GenerateSource(100)) + "type Later i32\n"
+	texts := []string{"", "\n", "\n\n", " ", "x", "1", "{", "}", "/*", "*/", "Later"}
+	rng := rand.New(rand.NewSource(1))
+
+	var inc parser.Incremental
+	inc.Parse([]byte(src))
+	for i := 0; i < 400; i++ {
+		start := rng.Intn(len(src) + 1)
+		end := start + rng.Intn(4)
+		if end > len(src) {
+			end = len(src)
+		}
+		text := texts[rng.Intn(len(texts))]
+		inc.Reparse(parser.Edit{Start: start, End: end, Text: []byte(text)})
+		src = src[:start] + text + src[end:]
+
+		if i%20 != 19 {
+			continue
+		}
+		inc.Collect()
+		whole := parseWhole(src, inc.Lexer.Symbols)
+		if !reflect.DeepEqual(inc.Parser.Nodes, whole.Nodes) || !reflect.DeepEqual(inc.Parser.Errors, whole.Errors) {
+			t.Fatalf("Expected the same nodes and errors as GenerateAST after %d edits, got %v instead of %v", i+1, inc.Parser.Errors, whole.Errors)
+		}
+		if string(inc.Source()) != src {
+			t.Fatalf("Expected the source after %d edits to be %q but it's %q", i+1, src, inc.Source())
+		}
+	}
+}
+
+func TestFlatRoundTrip(t *testing.T) {
+	src, err := ioutil.ReadFile("../testData/test-input.pi")
+	if err != nil {
+		t.Fatal(err)
+	}
+	src = append(append(src, '\n'), GenerateSource(10)...)
+	nodes := Parse(src, nil)
+
+	var flat ast.FlatAST
+	if err := flat.Flatten(nodes); err != nil {
+		t.Fatal(err)
+	}
+	inflated, err := flat.Inflate(nil)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if !reflect.DeepEqual(nodes, inflated) {
+		t.Errorf("Expected the AST to be the same after flattening and inflating it")
+	}
+
+	data, err := flat.MarshalBinary()
+	if err != nil {
+		t.Fatal(err)
+	}
+	var decoded ast.FlatAST
+	if err := decoded.UnmarshalBinary(data); err != nil {
+		t.Fatal(err)
+	}
+	if !reflect.DeepEqual(flat, decoded) {
+		t.Errorf("Expected the flat AST to be the same after encoding and decoding it")
+	}
+	data[len(data)/2] ^= 1
+	if err := decoded.UnmarshalBinary(data); err == nil {
+		t.Errorf("Expected decoding a corrupted flat AST to fail")
+	}
+}
+
+func TestASTCache(t *testing.T) {
+	cache := parser.ASTCache{Dir: t.TempDir(), Version: "test"}
+	src := GenerateSource(10)
+	var lexer ast.Lexer
+	lexer.Reset(src)
+	var p parser.Parser
+	p.GenerateASTFromLexer(&lexer)
+
+	if _, ok := cache.Load(src, lexer.Symbols, nil); ok {
+		t.Fatalf("Expected nothing to be cached yet")
+	}
+	if err := cache.Store(src, p.Nodes, &lexer); err != nil {
+		t.Fatal(err)
+	}
+	cached, ok := cache.Load(src, lexer.Symbols, nil)
+	if !ok || !reflect.DeepEqual(cached, p.Nodes) {
+		t.Errorf("Expected to load the same AST that was stored")
+	}
+
+	var fresh ast.Interner
+	if _, ok = cache.Load(src, &fresh, nil); !ok || !reflect.DeepEqual(fresh.Names, lexer.Symbols.Names) {
+		t.Errorf("Expected loading into an empty Interner to give the Symbols parsing did")
+	}
+
+	// Another compilation has its own Symbols
+	var symbols ast.Interner
+	symbols.Intern([]byte("somethingElse"))
+	cached, ok = cache.Load(src, &symbols, nil)
+	if !ok {
+		t.Fatalf("Expected the AST to be loaded with another Interner")
+	}
+	if fn := cached[1].(*ast.FuncDecl); symbols.Name(fn.Sym) != fn.Name {
+		t.Errorf("Expected Symbols to come from the Interner the AST was loaded with")
+	}
+
+	if _, ok := cache.Load(append(src, ' '), lexer.Symbols, nil); ok {
+		t.Errorf("Expected a different source not to be found in the cache")
+	}
+	other := parser.ASTCache{Dir: cache.Dir, Version: "other"}
+	if _, ok := other.Load(src, lexer.Symbols, nil); ok {
+		t.Errorf("Expected another version not to use the cache")
+	}
+}
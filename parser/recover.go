@@ -0,0 +1,125 @@
+package parser
+
+import (
+	"fmt"
+	"strings"
+
+	"github.com/IbrahimFadel/pi-lang/ast"
+	"github.com/IbrahimFadel/pi-lang/utils"
+)
+
+// A parse error, collected in Parser.Errors when the parser is recovering
+type Diagnostic struct {
+	Pos ast.TokenPos
+	Msg string
+}
+
+func (d Diagnostic) String() string {
+	return fmt.Sprintf("%s at pos: %v", d.Msg, d.Pos)
+}
+
+// The errors in a lazily parsed body, one per line with their positions
+type Diagnostics []Diagnostic
+
+func (diags Diagnostics) Error() string {
+	msgs := make([]string, len(diags))
+	for i, d := range diags {
+		msgs[i] = d.String()
+	}
+	return strings.Join(msgs, "\n")
+}
+
+// Panicked with after an error to unwind to the statement or declaration being parsed
+type bailout struct{}
+
+/*
+ * Report an error at pos
+ * When recovering it's added to Errors and parsing bails out of the current statement or declaration,
+ * otherwise it's fatal
+ */
+func (p *Parser) Error(pos ast.TokenPos, msg string) {
+	if !p.Recover {
+		utils.FatalError(fmt.Sprintf(msg+" at pos: %v", pos))
+	}
+	p.Errors = append(p.Errors, Diagnostic{Pos: pos, Msg: msg})
+	panic(bailout{})
+}
+
+func isDeclStart(tokenType ast.TokenType) bool {
+	return tokenType == ast.TokenTypeFn || tokenType == ast.TokenTypeType || tokenType == ast.TokenTypePackage
+}
+
+func isStmtBoundary(tokenType ast.TokenType) bool {
+	switch tokenType {
+	case ast.TokenTypeSemicolon, ast.TokenTypeCloseCurlyBracket, ast.TokenTypeReturn, ast.TokenTypeMut, ast.TokenTypeConst:
+		return true
+	}
+	return isDeclStart(tokenType)
+}
+
+/*
+ * Skip to the next token stop accepts (or EOF)
+ * If nothing has been read since start at least one token is skipped, so the same error can't come up forever
+ */
+func (p *Parser) Sync(start int, stop func(ast.TokenType) bool) {
+	if p.TokIndex == start && p.CurTok.TokenType != ast.TokenTypeEOF {
+		p.EatToken()
+	}
+	for p.CurTok.TokenType != ast.TokenTypeEOF && !stop(p.CurTok.TokenType) {
+		p.EatToken()
+	}
+}
+
+// Parse a top level declaration, skipping to the next one if it has an error (ok is false then)
+func (p *Parser) ParseDeclRecovering() (node ast.Node, ok bool) {
+	start := p.TokIndex
+	defer func() {
+		if r := recover(); r != nil {
+			if _, isBailout := r.(bailout); !isBailout {
+				panic(r)
+			}
+			p.Sync(start, isDeclStart)
+			node, ok = nil, false
+		}
+	}()
+
+	node, err := p.ParseToken(p.CurTok)
+	if err != nil {
+		p.Error(p.CurTok.Pos, err.Error())
+	}
+	return node, true
+}
+
+/*
+ * Parse a statement, skipping to the next one if it has an error (ok is false then)
+ * If the next thing after the error is a declaration, the declaration the statement is in is given up on too
+ * A declaration is never skipped here, so declarations never run into each other
+ */
+func (p *Parser) ParseStatementRecovering() (stmt ast.Stmt, ok bool) {
+	start := p.TokIndex
+	defer func() {
+		if r := recover(); r != nil {
+			if _, isBailout := r.(bailout); !isBailout {
+				panic(r)
+			}
+			if isDeclStart(p.CurTok.TokenType) {
+				// Skipping it would swallow the next declaration, so it's left for ParseNodes
+				panic(bailout{})
+			}
+			p.Sync(start, isStmtBoundary)
+			if p.CurTok.TokenType == ast.TokenTypeEOF || isDeclStart(p.CurTok.TokenType) {
+				panic(bailout{})
+			}
+			if p.CurTok.TokenType == ast.TokenTypeSemicolon {
+				p.EatToken()
+			}
+			stmt, ok = nil, false
+		}
+	}()
+
+	stmt, err := p.ParseStatement()
+	if err != nil {
+		p.Error(p.CurTok.Pos, fmt.Sprintf("could not parse statement: %s", err.Error()))
+	}
+	return stmt, true
+}
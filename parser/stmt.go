@@ -15,6 +15,13 @@ func (p *Parser) ParseBlockStmt() (ast.BlockStmt, error) {
 	p.EatToken()
 
 	for p.CurTok.TokenType != ast.TokenTypeCloseCurlyBracket {
+		if p.Recover {
+			if stmt, ok := p.ParseStatementRecovering(); ok {
+				block.List = append(block.List, stmt)
+			}
+			continue
+		}
+
 		stmt, err := p.ParseStatement()
 		if err != nil {
 			return block, fmt.Errorf("could not parse statement: %s", err.Error())
@@ -28,8 +35,8 @@ func (p *Parser) ParseBlockStmt() (ast.BlockStmt, error) {
 	block.Start = startPos
 	block.End = endPos
 
-	block.Constants = make(map[string]value.Value)
-	block.Mutables = make(map[string]value.Value)
+	block.Constants = make(map[ast.Symbol]value.Value)
+	block.Mutables = make(map[ast.Symbol]value.Value)
 
 	return block, nil
 }
@@ -49,8 +56,8 @@ func (p *Parser) ParseStatement() (ast.Stmt, error) {
 	}
 }
 
-func (p *Parser) ParseReturn() (ast.ReturnStmt, error) {
-	var ret ast.ReturnStmt
+func (p *Parser) ParseReturn() (*ast.ReturnStmt, error) {
+	ret := p.Arena.NewReturnStmt(ast.ReturnStmt{})
 
 	retPos := p.CurTok.Pos
 
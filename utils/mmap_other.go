@@ -0,0 +1,14 @@
+//go:build !linux && !darwin && !freebsd && !netbsd && !openbsd
+// +build !linux,!darwin,!freebsd,!netbsd,!openbsd
+
+package utils
+
+import (
+	"errors"
+	"os"
+)
+
+// No mmap here, ReadFileBuffer falls back to reading the file
+func mapFile(file *os.File, size int) ([]byte, error) {
+	return nil, errors.New("memory mapping is not supported on this platform")
+}
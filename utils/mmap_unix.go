@@ -0,0 +1,18 @@
+//go:build linux || darwin || freebsd || netbsd || openbsd
+// +build linux darwin freebsd netbsd openbsd
+
+package utils
+
+import (
+	"os"
+	"syscall"
+)
+
+/*
+ * The mapping is private, so writes to the file after it's mapped aren't guaranteed to show up in the buffer
+ * It's never unmapped, the lexer, the AST and the cache all hold slices of it and source buffers live as long as the compiler does
+ * Truncating the file while it's being compiled can still fault on the pages past the new end, the same as with any mapped file
+ */
+func mapFile(file *os.File, size int) ([]byte, error) {
+	return syscall.Mmap(int(file.Fd()), 0, size, syscall.PROT_READ, syscall.MAP_PRIVATE)
+}
@@ -1,32 +1,45 @@
 package utils
 
 import (
-	"bufio"
 	"bytes"
+	"fmt"
+	"io"
 	"io/ioutil"
 	"os"
 	"strconv"
 )
 
-func ReadFileContent(filePath string) []string {
-	var content []string
-
+/*
+ * Get the whole content of a file as one buffer
+ * Non-empty regular files are memory mapped rather than read, so they're never copied onto the heap
+ * Anything else (pipes, /dev/stdin, ...) reports a size of 0 and is read to the end instead
+ * The buffer is read-only and stays valid for the rest of the process
+ */
+func ReadFileBuffer(filePath string) []byte {
 	file, err := os.Open(filePath)
 	if err != nil {
 		FatalError(err.Error())
 	}
 	defer file.Close()
 
-	scanner := bufio.NewScanner(file)
-	// optionally, resize scanner's capacity for lines over 64K, see next example
-	for scanner.Scan() {
-		content = append(content, scanner.Text()+"\n")
+	info, err := file.Stat()
+	if err != nil {
+		FatalError(err.Error())
+	}
+	size := info.Size()
+	if info.Mode().IsRegular() && size > 0 {
+		if int64(int(size)) != size {
+			FatalError(fmt.Sprintf("%s is too large to be read (%d bytes)", filePath, size))
+		}
+		if content, err := mapFile(file, int(size)); err == nil {
+			return content
+		}
 	}
 
-	if err := scanner.Err(); err != nil {
+	content, err := io.ReadAll(file)
+	if err != nil {
 		FatalError(err.Error())
 	}
-
 	return content
 }
 